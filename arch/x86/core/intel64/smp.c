@@ -39,4 +39,25 @@ void arch_sched_ipi(void)
 	z_loapic_ipi(0, LOAPIC_ICR_IPI_OTHERS, CONFIG_SCHED_IPI_VECTOR);
 }
 
+void arch_sched_directed_ipi(uint32_t cpu_bitmap)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int id = arch_curr_cpu()->id;
+
+	cpu_bitmap &= BIT_MASK(num_cpus) & ~BIT(id);
+
+	/* The shorthand takes a single ICR write for all other CPUs */
+	if (cpu_bitmap == (BIT_MASK(num_cpus) & ~BIT(id))) {
+		arch_sched_ipi();
+		return;
+	}
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if ((cpu_bitmap & BIT(i)) != 0) {
+			z_loapic_ipi(x86_cpu_loapics[i], LOAPIC_ICR_IPI,
+				     CONFIG_SCHED_IPI_VECTOR);
+		}
+	}
+}
+
 SYS_INIT(arch_smp_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -495,6 +495,18 @@ static inline uint32_t arch_proc_id(void);
  */
 void arch_sched_ipi(void);
 
+#if defined(CONFIG_ARCH_HAS_DIRECTED_IPIS) || defined(__DOXYGEN__)
+/**
+ * Send an interrupt to a set of CPUs
+ *
+ * This will invoke z_sched_ipi() on the CPUs of @a cpu_bitmap other
+ * than the calling one.
+ *
+ * @param cpu_bitmap Bitmap of the CPUs to interrupt, by CPU index
+ */
+void arch_sched_directed_ipi(uint32_t cpu_bitmap);
+#endif /* CONFIG_ARCH_HAS_DIRECTED_IPIS */
+
 
 int arch_smp_init(void);
 
@@ -1435,6 +1435,23 @@ const char *k_thread_state_str(k_tid_t thread_id, char *buf, size_t buf_size);
 
 #endif
 
+/**
+ * @brief Generates a timeout value allowed to expire late
+ *
+ * This macro generates a timeout delay that expires at the earliest
+ * when @p t does, and at the latest @p slack later.  The kernel uses
+ * that margin to expire timeouts close to each other on the same
+ * system timer interrupt.  Only relative timeouts other than
+ * K_NO_WAIT can have slack, others are returned unchanged, as is
+ * @p t if CONFIG_TIMEOUT_SLACK is not enabled.
+ *
+ * @param t Timeout delay value
+ * @param slack Relative timeout value, K_FOREVER for the largest slack
+ *              supported
+ * @return Timeout delay value
+ */
+#define K_TIMEOUT_SLACK(t, slack) z_timeout_slack(t, slack)
+
 /**
  * @}
  */
@@ -1481,7 +1498,6 @@ struct k_timer {
 	.timeout = { \
 		.node = {},\
 		.fn = z_timer_expiration_handler, \
-		.dticks = 0, \
 	}, \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
 	.expiry_fn = expiry, \
@@ -1841,6 +1857,14 @@ struct k_queue {
 
 	Z_DECL_POLL_EVENT
 
+#ifdef CONFIG_QUEUE_LOCKLESS
+	/* Items pushed by producers and not seen by consumers yet, newest
+	 * first, and the Z_QUEUE_LOCKLESS_* flags of the queue.
+	 */
+	atomic_ptr_t lockless_head;
+	atomic_t lockless;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_queue)
 };
 
@@ -1848,14 +1872,28 @@ struct k_queue {
  * @cond INTERNAL_HIDDEN
  */
 
+#define Z_QUEUE_LOCKLESS_FIFO		BIT(0)	/* Lockless, FIFO order */
+#define Z_QUEUE_LOCKLESS_LIFO		BIT(1)	/* Lockless, LIFO order */
+#define Z_QUEUE_LOCKLESS_WAITERS	BIT(2)	/* Threads may be pending */
+#define Z_QUEUE_LOCKLESS_POLLED		BIT(3)	/* Poll events may be registered */
+
 #define Z_QUEUE_INITIALIZER(obj) \
+	Z_QUEUE_INITIALIZER_FLAGS(obj, 0)
+
+#define Z_QUEUE_INITIALIZER_FLAGS(obj, queue_flags) \
 	{ \
 	.data_q = SYS_SFLIST_STATIC_INIT(&obj.data_q), \
 	.lock = { }, \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q),	\
+	IF_ENABLED(CONFIG_QUEUE_LOCKLESS,	\
+		   (.lockless = ATOMIC_INIT(queue_flags),)) \
 	Z_POLL_EVENT_OBJ_INIT(obj)		\
 	}
 
+#ifdef CONFIG_QUEUE_LOCKLESS
+void z_queue_lockless_init(struct k_queue *queue, uint32_t order);
+#endif
+
 /**
  * INTERNAL_HIDDEN @endcond
  */
@@ -2077,6 +2115,11 @@ __syscall int k_queue_is_empty(struct k_queue *queue);
 
 static inline int z_impl_k_queue_is_empty(struct k_queue *queue)
 {
+#ifdef CONFIG_QUEUE_LOCKLESS
+	if (atomic_ptr_get(&queue->lockless_head) != NULL) {
+		return 0;
+	}
+#endif
 	return (int)sys_sflist_is_empty(&queue->data_q);
 }
 
@@ -2610,6 +2653,45 @@ struct k_fifo {
 	STRUCT_SECTION_ITERABLE(k_fifo, name) = \
 		Z_FIFO_INITIALIZER(name)
 
+#if defined(CONFIG_QUEUE_LOCKLESS) || defined(__DOXYGEN__)
+/**
+ * @brief Initialize a lockless FIFO queue.
+ *
+ * This routine initializes a FIFO queue, prior to its first use, so that
+ * k_fifo_put(), k_fifo_alloc_put(), k_fifo_put_list() and k_fifo_put_slist()
+ * add data items to it with an atomic compare-and-swap. The queue lock is
+ * only taken by them when a thread is waiting on the queue or polling it.
+ *
+ * Threads getting data items from the queue still serialize on its lock.
+ * The k_queue APIs inserting data items anywhere but at the tail of the
+ * queue, or removing a given data item, cannot be used on it.
+ *
+ * @param fifo Address of the FIFO queue.
+ */
+#define k_fifo_lockless_init(fifo)                                       \
+	({                                                               \
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, init, fifo);             \
+	z_queue_lockless_init(&(fifo)->_queue, Z_QUEUE_LOCKLESS_FIFO);   \
+	K_OBJ_CORE_INIT(K_OBJ_CORE(fifo), _obj_type_fifo);               \
+	K_OBJ_CORE_LINK(K_OBJ_CORE(fifo));                               \
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, init, fifo);              \
+	})
+
+/**
+ * @brief Statically define and initialize a lockless FIFO queue.
+ *
+ * Same as K_FIFO_DEFINE(), for a FIFO queue initialized as with
+ * k_fifo_lockless_init().
+ *
+ * @param name Name of the FIFO queue.
+ */
+#define K_FIFO_LOCKLESS_DEFINE(name) \
+	STRUCT_SECTION_ITERABLE(k_fifo, name) = { \
+		._queue = Z_QUEUE_INITIALIZER_FLAGS(name._queue, \
+						    Z_QUEUE_LOCKLESS_FIFO) \
+	}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 /** @} */
 
 struct k_lifo {
@@ -2735,6 +2817,45 @@ struct k_lifo {
 	STRUCT_SECTION_ITERABLE(k_lifo, name) = \
 		Z_LIFO_INITIALIZER(name)
 
+#if defined(CONFIG_QUEUE_LOCKLESS) || defined(__DOXYGEN__)
+/**
+ * @brief Initialize a lockless LIFO queue.
+ *
+ * This routine initializes a LIFO queue, prior to its first use, so that
+ * k_lifo_put() and k_lifo_alloc_put() add data items to it with an atomic
+ * compare-and-swap. The queue lock is only taken by them when a thread is
+ * waiting on the queue or polling it.
+ *
+ * Threads getting data items from the queue still serialize on its lock.
+ * The k_queue APIs inserting data items anywhere but at the head of the
+ * queue, or removing a given data item, cannot be used on it.
+ *
+ * @param lifo Address of the LIFO queue.
+ */
+#define k_lifo_lockless_init(lifo)                                       \
+	({                                                               \
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_lifo, init, lifo);             \
+	z_queue_lockless_init(&(lifo)->_queue, Z_QUEUE_LOCKLESS_LIFO);   \
+	K_OBJ_CORE_INIT(K_OBJ_CORE(lifo), _obj_type_lifo);               \
+	K_OBJ_CORE_LINK(K_OBJ_CORE(lifo));                               \
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_lifo, init, lifo);              \
+	})
+
+/**
+ * @brief Statically define and initialize a lockless LIFO queue.
+ *
+ * Same as K_LIFO_DEFINE(), for a LIFO queue initialized as with
+ * k_lifo_lockless_init().
+ *
+ * @param name Name of the LIFO queue.
+ */
+#define K_LIFO_LOCKLESS_DEFINE(name) \
+	STRUCT_SECTION_ITERABLE(k_lifo, name) = { \
+		._queue = Z_QUEUE_INITIALIZER_FLAGS(name._queue, \
+						    Z_QUEUE_LOCKLESS_LIFO) \
+	}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 /** @} */
 
 /**
@@ -2882,6 +3003,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_q_worker;
 struct k_work_queue_config;
 extern struct k_work_q k_sys_work_q;
 
@@ -2895,6 +3017,23 @@ extern struct k_work_q k_sys_work_q;
  * @{
  */
 
+/**
+ * Mutex contention statistics
+ * @ingroup mutex_apis
+ */
+struct k_mutex_stats {
+	/** Number of times the mutex was locked */
+	uint32_t locks;
+	/** Number of lock attempts finding it held by another thread */
+	uint32_t contended;
+	/** Number of contended locks that got it while spinning */
+	uint32_t spin_acquired;
+	/** Number of contended locks that pended on it */
+	uint32_t pended;
+	/** Cycles spent spinning on the mutex */
+	uint64_t spin_cycles;
+};
+
 /**
  * Mutex Structure
  * @ingroup mutex_apis
@@ -2916,6 +3055,9 @@ struct k_mutex {
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	struct k_obj_core obj_core;
 #endif
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	struct k_mutex_stats stats;
+#endif
 };
 
 /**
@@ -3092,6 +3234,273 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @}
  */
 
+/**
+ * Reader-writer lock structure
+ */
+struct k_rwlock {
+	/** Threads waiting to lock for reading */
+	_wait_q_t rd_wait_q;
+	/** Threads waiting to lock for writing */
+	_wait_q_t wr_wait_q;
+
+	/** Protects the fields below */
+	struct k_spinlock lock;
+
+	/** Writer owning the lock, if any */
+	struct k_thread *owner;
+
+	/** Number of threads holding the lock for reading */
+	uint32_t readers;
+
+	/** Original priority of the writer */
+	int owner_orig_prio;
+
+	/** K_RWLOCK_* flags */
+	uint32_t flags;
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+	struct k_obj_core obj_core;
+#endif
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_RWLOCK_INITIALIZER(obj, rwlock_flags)                                \
+	{                                                                      \
+		.rd_wait_q = Z_WAIT_Q_INIT(&obj.rd_wait_q),                    \
+		.wr_wait_q = Z_WAIT_Q_INIT(&obj.wr_wait_q),                    \
+		.owner = NULL,                                                 \
+		.readers = 0,                                                  \
+		.owner_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO,           \
+		.flags = (rwlock_flags),                                       \
+	}
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @defgroup rwlock_apis Reader-Writer Lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Prefer writers over readers.
+ *
+ * By default, a reader-writer lock that is not locked for writing can be
+ * locked for reading even when writers are waiting for it. With this flag,
+ * readers wait as soon as a writer is waiting, so writers cannot be starved
+ * by a steady stream of readers.
+ */
+#define K_RWLOCK_PREFER_WRITER BIT(0)
+
+/**
+ * @brief Statically define and initialize a reader-writer lock.
+ *
+ * The lock can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_rwlock <name>; @endcode
+ *
+ * @param name Name of the reader-writer lock.
+ * @param flags K_RWLOCK_* flags, or 0.
+ */
+#define K_RWLOCK_DEFINE(name, flags)                                           \
+	STRUCT_SECTION_ITERABLE(k_rwlock, name) =                              \
+		Z_RWLOCK_INITIALIZER(name, flags)
+
+/**
+ * @brief Initialize a reader-writer lock.
+ *
+ * Upon completion, the lock is neither locked for reading nor for writing.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param flags K_RWLOCK_* flags, or 0.
+ *
+ * @retval 0 Reader-writer lock initialized.
+ * @retval -EINVAL Invalid flags.
+ */
+__syscall int k_rwlock_init(struct k_rwlock *rwlock, uint32_t flags);
+
+/**
+ * @brief Lock a reader-writer lock for reading.
+ *
+ * Any number of threads may hold the lock for reading at the same time. If
+ * the lock is held for writing (or, with @ref K_RWLOCK_PREFER_WRITER, if a
+ * writer is waiting for it), the calling thread waits until it is granted
+ * the lock or the timeout expires. A waiting thread raises the priority of
+ * the writer owning the lock, as with mutexes.
+ *
+ * Read locks are not recursive. Reader-writer locks may not be used in ISRs.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the reader-writer lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Locked for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader-writer lock locked for reading.
+ *
+ * When the last reader unlocks it, the lock is handed over to the first
+ * waiting writer, if any.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Unlocked.
+ * @retval -EINVAL The lock is not locked for reading.
+ */
+__syscall int k_rwlock_read_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for writing.
+ *
+ * The calling thread waits until no other thread holds the lock, either for
+ * reading or for writing, or until the timeout expires. While a writer owns
+ * the lock, the threads waiting for it raise its priority, as with mutexes.
+ * Readers holding the lock are not tracked and their priority is not
+ * raised.
+ *
+ * Write locks are not recursive. Reader-writer locks may not be used in
+ * ISRs.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the reader-writer lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Locked for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EDEADLK The current thread already owns the lock for writing.
+ */
+__syscall int k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader-writer lock locked for writing.
+ *
+ * The lock is handed over to the waiting readers or to the first waiting
+ * writer, as set by the lock's flags.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Unlocked.
+ * @retval -EPERM The current thread does not own the lock for writing.
+ */
+__syscall int k_rwlock_write_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup rcu_apis Read-Copy-Update APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+struct k_rcu_head;
+
+/**
+ * @brief Read-copy-update callback.
+ *
+ * @param head Address of the RCU head passed to k_rcu_call().
+ */
+typedef void (*k_rcu_callback_t)(struct k_rcu_head *head);
+
+/**
+ * @brief Read-copy-update head.
+ *
+ * Embedded in an object whose reclamation is deferred with k_rcu_call().
+ */
+struct k_rcu_head {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	k_rcu_callback_t func;
+	/** @endcond */
+};
+
+/**
+ * @brief Enter a read-side critical section.
+ *
+ * Objects obtained with k_rcu_dereference() within the section are not
+ * reclaimed before the matching k_rcu_read_unlock(). Sections may be
+ * nested and may be entered from ISRs. They mask interrupts on the current
+ * CPU, so that it can't context switch meanwhile: they must be short and
+ * must not block.
+ *
+ * @return A key that must be passed to k_rcu_read_unlock().
+ */
+static inline unsigned int k_rcu_read_lock(void)
+{
+	return arch_irq_lock();
+}
+
+/**
+ * @brief Leave a read-side critical section.
+ *
+ * @param key The value returned by the matching k_rcu_read_lock().
+ */
+static inline void k_rcu_read_unlock(unsigned int key)
+{
+	arch_irq_unlock(key);
+}
+
+/**
+ * @brief Read an RCU-protected pointer.
+ *
+ * Must be used within a read-side critical section. The pointed-to object
+ * is guaranteed to be initialized as it was when it was published with
+ * k_rcu_assign_pointer().
+ *
+ * @param p RCU-protected pointer.
+ */
+#define k_rcu_dereference(p) __atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+
+/**
+ * @brief Publish a new version of an RCU-protected pointer.
+ *
+ * Updates @p p so that readers see the object @p v points to fully
+ * initialized. Writers must serialize between themselves.
+ *
+ * @param p RCU-protected pointer.
+ * @param v New value.
+ */
+#define k_rcu_assign_pointer(p, v) __atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+
+/**
+ * @brief Reclaim an object after a grace period.
+ *
+ * Calls @p func with @p head from the system work queue once every read-side
+ * critical section in progress on any CPU has ended. The object embedding
+ * @p head must have been unpublished beforehand, so that new sections can't
+ * reach it. This does not block and may be called from ISRs.
+ *
+ * Requires @kconfig{CONFIG_RCU}.
+ *
+ * @param head Address of the RCU head embedded in the object.
+ * @param func Function reclaiming the object.
+ */
+void k_rcu_call(struct k_rcu_head *head, k_rcu_callback_t func);
+
+/**
+ * @brief Wait for a grace period.
+ *
+ * Returns once every read-side critical section in progress on any CPU
+ * when it was called has ended. May not be called from ISRs nor from the
+ * system work queue.
+ *
+ * Requires @kconfig{CONFIG_RCU}.
+ */
+void k_rcu_synchronize(void);
+
+/**
+ * @}
+ */
+
 /**
  * @cond INTERNAL_HIDDEN
  */
@@ -3464,10 +3873,39 @@ void k_work_queue_start(struct k_work_q *queue,
  *
  * @param queue pointer to the queue structure.
  *
- * @return the thread associated with the work queue.
+ * @return the thread associated with the work queue.  For a queue with
+ * threads added by k_work_queue_worker_add() this is the thread started by
+ * k_work_queue_start().
  */
 static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue);
 
+/** @brief Add a thread to a work queue.
+ *
+ * This creates and starts an additional thread processing the items
+ * submitted to @p queue, with the priority of the thread started by
+ * k_work_queue_start().  Items are then handed to whichever queue thread
+ * is available, so distinct items can run concurrently.  A given item is
+ * never run by two threads at the same time: an item resubmitted while it
+ * is running is held back until its current run has completed, and
+ * flushes and cancellations keep their single-threaded semantics.
+ *
+ * Threads cannot be removed from a queue.
+ *
+ * @kconfig_dep{CONFIG_WORKQUEUE_POOL}
+ *
+ * @param queue pointer to a queue started with k_work_queue_start().
+ *
+ * @param worker pointer to the structure holding the thread.  This must
+ * remain valid for as long as the queue is in use.
+ *
+ * @param stack pointer to the thread stack area.
+ *
+ * @param stack_size size of the thread stack area, in bytes.
+ */
+void k_work_queue_worker_add(struct k_work_q *queue,
+			     struct k_work_q_worker *worker,
+			     k_thread_stack_t *stack, size_t stack_size);
+
 /** @brief Wait until the work queue has drained, optionally plugging it.
  *
  * This blocks submission to the work queue except when coming from queue
@@ -3819,6 +4257,8 @@ enum {
 	/* Static work queue flags */
 	K_WORK_QUEUE_NO_YIELD_BIT = 8,
 	K_WORK_QUEUE_NO_YIELD = BIT(K_WORK_QUEUE_NO_YIELD_BIT),
+	K_WORK_QUEUE_PIN_CPUS_BIT = 9,
+	K_WORK_QUEUE_PIN_CPUS = BIT(K_WORK_QUEUE_PIN_CPUS_BIT),
 
 /**
  * INTERNAL_HIDDEN @endcond
@@ -3940,6 +4380,10 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* The item being flushed, the flusher is held back while it runs. */
+	struct k_work *target;
+#endif /* CONFIG_WORKQUEUE_POOL */
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4004,6 +4448,27 @@ struct k_work_queue_config {
 	 * control.
 	 */
 	bool no_yield;
+
+	/** Control whether the work queue threads are pinned to CPUs.
+	 *
+	 * When set, the thread started by k_work_queue_start() is pinned to
+	 * CPU 0 and each thread added with k_work_queue_worker_add() to the
+	 * next CPU, wrapping around.  This is ignored unless
+	 * CONFIG_SCHED_CPU_MASK is enabled.
+	 */
+	bool pin_cpus;
+};
+
+/** @brief An additional thread animating a work queue.
+ *
+ * See k_work_queue_worker_add().
+ */
+struct k_work_q_worker {
+	/* The thread that animates the work. */
+	struct k_thread thread;
+
+	/* Node in the list of queue workers. */
+	sys_snode_t node;
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -4011,6 +4476,14 @@ struct k_work_q {
 	/* The thread that animates the work. */
 	struct k_thread thread;
 
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Additional threads animating the work. */
+	sys_slist_t workers;
+
+	/* Number of threads running a work item. */
+	uint16_t busy;
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 	/* All the following fields must be accessed only while the
 	 * work module spinlock is held.
 	 */
@@ -4402,8 +4875,11 @@ int k_work_poll_cancel(struct k_work_poll *work);
  * @brief Message Queue Structure
  */
 struct k_msgq {
-	/** Message queue wait queue */
-	_wait_q_t wait_q;
+	/** Message queue wait queues */
+	struct {
+		_wait_q_t readers; /**< Reader wait queue */
+		_wait_q_t writers; /**< Writer wait queue */
+	} wait_q;
 	/** Lock */
 	struct k_spinlock lock;
 	/** Message size */
@@ -4420,6 +4896,10 @@ struct k_msgq {
 	char *write_ptr;
 	/** Number of used messages */
 	uint32_t used_msgs;
+	/** Slots held by a put claim, counting the messages queued behind it */
+	uint32_t put_held;
+	/** Slots held by a get claim, counting the messages received after it */
+	uint32_t get_held;
 
 	Z_DECL_POLL_EVENT
 
@@ -4439,7 +4919,10 @@ struct k_msgq {
 
 #define Z_MSGQ_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs) \
 	{ \
-	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.wait_q = { \
+		.readers = Z_WAIT_Q_INIT(&obj.wait_q.readers), \
+		.writers = Z_WAIT_Q_INIT(&obj.wait_q.writers) \
+	}, \
 	.msg_size = q_msg_size, \
 	.max_msgs = q_max_msgs, \
 	.buffer_start = q_buffer, \
@@ -4447,6 +4930,8 @@ struct k_msgq {
 	.read_ptr = q_buffer, \
 	.write_ptr = q_buffer, \
 	.used_msgs = 0, \
+	.put_held = 0, \
+	.get_held = 0, \
 	Z_POLL_EVENT_OBJ_INIT(obj) \
 	}
 
@@ -4591,6 +5076,157 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a num_msgs messages, stored one after the
+ * other at @a data, to message queue @a msgq while taking the queue lock
+ * only once.  As many messages are sent as there is room for in the queue
+ * or threads waiting to receive them.
+ *
+ * The caller only waits if none of the messages can be sent right away,
+ * in which case it waits for the first message to be sent, as with
+ * k_msgq_put().
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to the messages.
+ * @param num_msgs Number of messages at @a data.
+ * @param timeout Non-negative waiting period to send a message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages sent (at least 1) on success.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL @a num_msgs is 0.
+ */
+__syscall int k_msgq_put_n(struct k_msgq *msgq, const void *data,
+			   uint32_t num_msgs, k_timeout_t timeout);
+
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a num_msgs messages from message queue
+ * @a msgq, stored one after the other at @a data, while taking the queue
+ * lock only once.
+ *
+ * The caller only waits if the queue is empty, in which case it waits
+ * for a single message, as with k_msgq_get().
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold the received messages.
+ * @param num_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive a message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received (at least 1) on success.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL @a num_msgs is 0.
+ */
+__syscall int k_msgq_get_n(struct k_msgq *msgq, void *data, uint32_t num_msgs,
+			   k_timeout_t timeout);
+
+/**
+ * @brief Claim a message queue slot to send a message in place.
+ *
+ * This routine reserves the next free slot of message queue @a msgq and
+ * returns its address, so that the message can be built directly in the
+ * queue buffer instead of being copied into it.  The message is sent with
+ * k_msgq_put_commit().
+ *
+ * Only one put claim can be outstanding on a message queue.  Messages sent
+ * with k_msgq_put() while a slot is claimed are queued behind the claimed
+ * slot, and are not received before the claimed message is committed.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note This routine is only available to supervisor threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Address of the pointer receiving the slot address.
+ * @param timeout Non-negative waiting period to wait for a free slot,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Slot claimed.
+ * @retval -EBUSY A put claim is already outstanding.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_put_claim(struct k_msgq *msgq, void **slot, k_timeout_t timeout);
+
+/**
+ * @brief Send the message of a claimed message queue slot.
+ *
+ * This routine sends the message built in the slot claimed with
+ * k_msgq_put_claim(), along with the messages queued behind it.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message sent.
+ * @retval -EINVAL No put claim is outstanding.
+ */
+int k_msgq_put_commit(struct k_msgq *msgq);
+
+/**
+ * @brief Claim the first message of a message queue to read it in place.
+ *
+ * This routine receives the first message of message queue @a msgq
+ * without copying it: the address of its slot in the queue buffer is
+ * returned, and the slot is not reused until it is given back with
+ * k_msgq_get_release().
+ *
+ * Only one get claim can be outstanding on a message queue.  Messages can
+ * still be received with k_msgq_get() while a message is claimed, but
+ * their slots are only freed along with the claimed one.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note This routine is only available to supervisor threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Address of the pointer receiving the message address.
+ * @param timeout Waiting period to receive the message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Message received.
+ * @retval -EBUSY A get claim is already outstanding.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_get_claim(struct k_msgq *msgq, void **slot, k_timeout_t timeout);
+
+/**
+ * @brief Release a claimed message queue message.
+ *
+ * This routine gives back the slot of the message received with
+ * k_msgq_get_claim(), along with the slots of the messages received after
+ * it, so that new messages can be sent in them.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Slot released.
+ * @retval -EINVAL No get claim is outstanding.
+ */
+int k_msgq_get_release(struct k_msgq *msgq);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4630,7 +5266,8 @@ __syscall int k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx);
  *
  * This routine discards all unreceived messages in a message queue's ring
  * buffer. Any threads that are blocked waiting to send a message to the
- * message queue are unblocked and see an -ENOMSG error code.
+ * message queue are unblocked and see an -ENOMSG error code. Claimed slots,
+ * and the messages queued behind a slot claimed for sending, are left alone.
  *
  * @param msgq Address of the message queue.
  */
@@ -4662,7 +5299,8 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
-	return msgq->max_msgs - msgq->used_msgs;
+	return msgq->max_msgs - msgq->used_msgs - msgq->put_held -
+	       msgq->get_held;
 }
 
 /**
@@ -4863,6 +5501,12 @@ struct k_pipe {
 
 	uint8_t	       flags;		/**< Flags */
 
+#ifdef CONFIG_PIPE_SPSC
+	atomic_t       spsc_head;       /**< SPSC write index, owned by the writer */
+	atomic_t       spsc_tail;       /**< SPSC read index, owned by the reader */
+	atomic_t       spsc_waiters;    /**< SPSC sides waiting for the other one */
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_pipe)
 
 #ifdef CONFIG_OBJ_CORE_PIPE
@@ -4874,8 +5518,13 @@ struct k_pipe {
  * @cond INTERNAL_HIDDEN
  */
 #define K_PIPE_FLAG_ALLOC	BIT(0)	/** Buffer was allocated */
+#define K_PIPE_FLAG_SPSC	BIT(1)	/** Single reader, single writer */
 
 #define Z_PIPE_INITIALIZER(obj, pipe_buffer, pipe_buffer_size)     \
+	Z_PIPE_INITIALIZER_FLAGS(obj, pipe_buffer, pipe_buffer_size, 0)
+
+#define Z_PIPE_INITIALIZER_FLAGS(obj, pipe_buffer, pipe_buffer_size, \
+				 pipe_flags)                        \
 	{                                                           \
 	.buffer = pipe_buffer,                                      \
 	.size = pipe_buffer_size,                                   \
@@ -4888,7 +5537,7 @@ struct k_pipe {
 		.writers = Z_WAIT_Q_INIT(&obj.wait_q.writers)        \
 	},                                                          \
 	Z_POLL_EVENT_OBJ_INIT(obj)                                   \
-	.flags = 0,                                                 \
+	.flags = pipe_flags,                                        \
 	}
 
 /**
@@ -4927,6 +5576,45 @@ struct k_pipe {
  */
 void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size);
 
+#if defined(CONFIG_PIPE_SPSC) || defined(__DOXYGEN__)
+/**
+ * @brief Statically define and initialize a single reader, single writer pipe.
+ *
+ * Same as K_PIPE_DEFINE(), for a pipe initialized as with k_pipe_spsc_init().
+ *
+ * @param name Name of the pipe.
+ * @param pipe_buffer_size Size of the pipe's ring buffer (in bytes).
+ * @param pipe_align Alignment of the pipe's ring buffer (power of 2).
+ */
+#define K_PIPE_SPSC_DEFINE(name, pipe_buffer_size, pipe_align)		\
+	BUILD_ASSERT((pipe_buffer_size) > 0, "SPSC pipes need a ring buffer"); \
+	static unsigned char __noinit __aligned(pipe_align)		\
+		_k_pipe_buf_##name[pipe_buffer_size];			\
+	STRUCT_SECTION_ITERABLE(k_pipe, name) =				\
+		Z_PIPE_INITIALIZER_FLAGS(name, _k_pipe_buf_##name,	\
+					 pipe_buffer_size, K_PIPE_FLAG_SPSC)
+
+/**
+ * @brief Initialize a single reader, single writer pipe.
+ *
+ * This routine initializes a pipe object, prior to its first use, for a
+ * single thread or ISR writing to it and a single thread or ISR reading
+ * from it at a time.
+ *
+ * Such a pipe transfers data through its ring buffer without taking the
+ * pipe lock: the lock is only taken when the reader or the writer has to
+ * wait for the other one. Data is never copied directly between the
+ * reader and the writer, and flushing the pipe is only allowed to its
+ * reader.
+ *
+ * @param pipe Address of the pipe.
+ * @param buffer Address of the pipe's ring buffer.
+ * @param size Size of the pipe's ring buffer (in bytes), which must not be
+ *             zero.
+ */
+void k_pipe_spsc_init(struct k_pipe *pipe, unsigned char *buffer, size_t size);
+#endif /* CONFIG_PIPE_SPSC */
+
 /**
  * @brief Release a pipe's allocated buffer
  *
@@ -5053,20 +5741,41 @@ __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
  * @cond INTERNAL_HIDDEN
  */
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+struct k_mem_slab_cpu_stats {
+	/* Free blocks held in the CPU cache */
+	uint32_t num_cached;
+	/* Allocations and frees served by the CPU cache */
+	uint32_t hits;
+	/* Refills of the CPU cache from the slab */
+	uint32_t refills;
+	/* Flushes of the CPU cache to the slab */
+	uint32_t flushes;
+};
+#endif
+
 struct k_mem_slab_info {
 	uint32_t num_blocks;
 	size_t   block_size;
+	/* Blocks not on the slab free list, including CPU cached ones */
 	uint32_t num_used;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	uint32_t max_used;
 #endif
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	struct k_mem_slab_cpu_stats cpu_stats[CONFIG_MP_MAX_NUM_CPUS];
+#endif
 };
 
 struct k_mem_slab {
 	_wait_q_t wait_q;
+	_wait_q_t wait_n_q;
 	struct k_spinlock lock;
 	char *buffer;
 	char *free_list;
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	char *cpu_free_list[CONFIG_MP_MAX_NUM_CPUS];
+#endif
 	struct k_mem_slab_info info;
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
@@ -5080,6 +5789,7 @@ struct k_mem_slab {
 			       _slab_num_blocks)                      \
 	{                                                             \
 	.wait_q = Z_WAIT_Q_INIT(&(_slab).wait_q),                     \
+	.wait_n_q = Z_WAIT_Q_INIT(&(_slab).wait_n_q),                 \
 	.lock = {},                                                   \
 	.buffer = _slab_buffer,                                       \
 	.free_list = NULL,                                            \
@@ -5210,6 +5920,51 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem,
  */
 void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
 
+/**
+ * @brief Allocate several memory blocks from a memory slab.
+ *
+ * This routine allocates @a count memory blocks from a memory slab, taking
+ * the slab lock only once.  Either all the blocks are allocated or none of
+ * them are.
+ *
+ * If not enough blocks are available and waiting is allowed, the caller
+ * waits, without holding any block, until @a count blocks are available
+ * and takes them all at once.  Threads waiting in k_mem_slab_alloc() are
+ * handed freed blocks first.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note When CONFIG_MULTITHREADING=n any @a timeout is treated as K_NO_WAIT.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param slab Address of the memory slab.
+ * @param mem Array receiving the @a count block addresses.
+ * @param count Number of blocks to allocate.
+ * @param timeout Non-negative waiting period to wait for operation to complete.
+ *        Use K_NO_WAIT to return without waiting,
+ *        or K_FOREVER to wait as long as necessary.
+ *
+ * @retval 0 Memory allocated.
+ * @retval -ENOMEM Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL @a count is larger than the number of blocks of @a slab.
+ */
+int k_mem_slab_alloc_n(struct k_mem_slab *slab, void **mem, uint32_t count,
+		       k_timeout_t timeout);
+
+/**
+ * @brief Free several memory blocks allocated from a memory slab.
+ *
+ * This routine releases @a count memory blocks back to their memory slab,
+ * taking the slab lock only once.
+ *
+ * @param slab Address of the memory slab.
+ * @param mem Array of the memory blocks (as returned by k_mem_slab_alloc()
+ *        or k_mem_slab_alloc_n()).
+ * @param count Number of blocks to free.
+ */
+void k_mem_slab_free_n(struct k_mem_slab *slab, void **mem, uint32_t count);
+
 /**
  * @brief Get the number of used blocks in a memory slab.
  *
@@ -5222,7 +5977,17 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	uint32_t num_used = slab->info.num_used;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		num_used -= slab->info.cpu_stats[i].num_cached;
+	}
+
+	return num_used;
+#else
 	return slab->info.num_used;
+#endif
 }
 
 /**
@@ -5257,7 +6022,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5376,10 +6141,60 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes,
  */
 void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 
+/**
+ * @brief Allocate several blocks of memory from a k_heap
+ *
+ * Allocates @a count blocks of @a bytes bytes each from the heap, taking
+ * the heap lock only once.  Either all the blocks are allocated or none
+ * of them are: if they cannot all be allocated immediately, the call
+ * blocks for up to the specified timeout waiting for memory to be freed.
+ * The blocks can be freed one by one with k_heap_free(), or together
+ * with k_heap_free_n().
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note When CONFIG_MULTITHREADING=n any @a timeout is treated as K_NO_WAIT.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param h Heap from which to allocate
+ * @param mem Array receiving the @a count block pointers
+ * @param count Number of blocks to allocate
+ * @param bytes Desired size of each block
+ * @param timeout How long to wait, or K_NO_WAIT
+ *
+ * @retval 0 All the blocks were allocated.
+ * @retval -ENOMEM Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_heap_alloc_n(struct k_heap *h, void **mem, size_t count, size_t bytes,
+		   k_timeout_t timeout) __attribute_nonnull(1);
+
+/**
+ * @brief Free several blocks of memory to a k_heap
+ *
+ * Returns the @a count blocks pointed to by @a mem, which must have been
+ * returned from k_heap_alloc() or k_heap_alloc_n(), to the heap while
+ * taking the heap lock only once.
+ *
+ * @param h Heap to which to return the memory
+ * @param mem Array of valid memory blocks, or NULL pointers
+ * @param count Number of blocks to free
+ */
+void k_heap_free_n(struct k_heap *h, void **mem, size_t count) __attribute_nonnull(1);
+
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
-#define Z_HEAP_MIN_SIZE (sizeof(void *) > 4 ? 56 : 44)
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+/* Size class page lists, page map pointers and one page map word,
+ * plus chunk rounding.
+ */
+#define Z_HEAP_SMALL_OBJECTS_SIZE \
+	((CONFIG_SYS_HEAP_SMALL_OBJECT_CLASSES + 2) * sizeof(void *) + 12)
+#else
+#define Z_HEAP_SMALL_OBJECTS_SIZE 0
+#endif
+#define Z_HEAP_MIN_SIZE ((sizeof(void *) > 4 ? 56 : 44) + Z_HEAP_SMALL_OBJECTS_SIZE)
 
 /**
  * @brief Define a static k_heap in the specified linker section
@@ -5826,6 +6641,152 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/** Report an object of a poll set once per state change (edge triggered) */
+#define K_POLL_SET_EDGE BIT(0)
+
+/**
+ * @brief Poll set entry
+ *
+ * Storage for one object watched by a poll set, see K_POLL_SET_DEFINE()
+ * and k_poll_set_init().
+ */
+struct k_poll_set_entry {
+	/** PRIVATE - DO NOT TOUCH */
+	struct k_poll_event event;
+	sys_dnode_t ready_node;
+	uint32_t flags;
+};
+
+/**
+ * @brief Poll set
+ *
+ * A poll set is a persistent collection of objects a thread can wait on.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+	struct z_poller poller;
+	sys_dlist_t ready;
+	struct k_poll_set_entry *entries;
+	int max_entries;
+};
+
+#define Z_POLL_SET_INITIALIZER(obj, _entries, _max_entries) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.ready = SYS_DLIST_STATIC_INIT(&obj.ready), \
+	.entries = _entries, \
+	.max_entries = _max_entries, \
+	}
+
+/**
+ * @brief Statically define and initialize a poll set.
+ *
+ * The poll set can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_poll_set <name>; @endcode
+ *
+ * @param name Name of the poll set.
+ * @param max_entries Maximum number of objects the set can watch.
+ */
+#define K_POLL_SET_DEFINE(name, max_entries) \
+	static struct k_poll_set_entry \
+		_k_poll_set_entries_##name[max_entries]; \
+	STRUCT_SECTION_ITERABLE(k_poll_set, name) = \
+		Z_POLL_SET_INITIALIZER(name, _k_poll_set_entries_##name, \
+				       max_entries)
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * The entries must reside in kernel memory, so unlike the other poll set
+ * APIs this routine cannot be called from user mode.
+ *
+ * @param set Address of the poll set.
+ * @param entries Storage for the objects watched by the set.
+ * @param max_entries Number of elements in @a entries.
+ */
+void k_poll_set_init(struct k_poll_set *set, struct k_poll_set_entry *entries,
+		     int max_entries);
+
+/**
+ * @brief Add an object to a poll set.
+ *
+ * The object stays registered with the set until it is removed with
+ * k_poll_set_remove(), so that waiting on the set does not cost more when
+ * it watches more objects: k_poll_set_wait() only looks at the objects
+ * whose state changed.
+ *
+ * By default, an object is reported by every k_poll_set_wait() call as long
+ * as its condition holds (level triggered). With K_POLL_SET_EDGE, it is
+ * only reported once each time its state changes to ready.
+ *
+ * @param set Address of the poll set.
+ * @param type Type of event, one of the K_POLL_TYPE_xxx values other than
+ *             K_POLL_TYPE_IGNORE.
+ * @param obj Kernel object or poll signal.
+ * @param tag Tag reported with the object's events.
+ * @param flags 0 or K_POLL_SET_EDGE.
+ *
+ * @retval 0 Object added.
+ * @retval -EEXIST Object already in the set.
+ * @retval -ENOSPC Set is full.
+ * @retval -EINVAL Bad parameters.
+ */
+__syscall int k_poll_set_add(struct k_poll_set *set, uint32_t type, void *obj,
+			     uint8_t tag, uint32_t flags);
+
+/**
+ * @brief Change the tag and flags of an object in a poll set.
+ *
+ * @param set Address of the poll set.
+ * @param obj Object previously added with k_poll_set_add().
+ * @param tag Tag reported with the object's events.
+ * @param flags 0 or K_POLL_SET_EDGE.
+ *
+ * @retval 0 Object modified.
+ * @retval -ENOENT Object not in the set.
+ */
+__syscall int k_poll_set_modify(struct k_poll_set *set, void *obj, uint8_t tag,
+				uint32_t flags);
+
+/**
+ * @brief Remove an object from a poll set.
+ *
+ * @param set Address of the poll set.
+ * @param obj Object previously added with k_poll_set_add().
+ *
+ * @retval 0 Object removed.
+ * @retval -ENOENT Object not in the set.
+ */
+__syscall int k_poll_set_remove(struct k_poll_set *set, void *obj);
+
+/**
+ * @brief Wait for objects of a poll set to be ready.
+ *
+ * This routine waits until at least one object of @a set is ready, and
+ * fills @a events with up to @a num_events of them: the type, object, tag
+ * and state fields of each event are set as they would be by k_poll(),
+ * ready to be looked at directly by the caller. Objects left over are
+ * reported by the next call, and wake up another waiting thread if any.
+ *
+ * The same caveats as for k_poll() apply: the objects are not given to the
+ * caller, who still has to take them without blocking.
+ *
+ * @param set Address of the poll set.
+ * @param events Array receiving the ready events.
+ * @param num_events Number of elements in @a events.
+ * @param timeout Waiting period for an object to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events stored in @a events, if positive.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL Bad parameters.
+ */
+__syscall int k_poll_set_wait(struct k_poll_set *set,
+			      struct k_poll_event *events, int num_events,
+			      k_timeout_t timeout);
+
 /** @} */
 
 /**
@@ -6086,6 +7047,30 @@ void k_sys_runtime_stats_enable(void);
  */
 void k_sys_runtime_stats_disable(void);
 
+#if defined(CONFIG_SCHED_LATENCY_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the scheduling latencies of the threads of a priority
+ *
+ * Latencies are accounted for at the priority threads have when they
+ * start running.
+ *
+ * @param prio Thread priority
+ * @param stats Pointer to struct to copy the latency histograms into
+ * @retval 0 on success
+ * @retval -EINVAL if @p prio is not a valid priority or @p stats is NULL
+ */
+int k_sched_latency_stats_get(int prio, struct k_sched_latency_stats *stats);
+
+/**
+ * @brief Reset the scheduling latencies of all priorities
+ *
+ * This routine clears the histograms reported by
+ * k_sched_latency_stats_get(). It does not affect those of individual
+ * threads.
+ */
+void k_sched_latency_stats_reset(void);
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 #ifdef __cplusplus
 }
 #endif
@@ -57,6 +57,16 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+#if defined(CONFIG_DEMAND_PAGING_READ_AHEAD) || defined(__DOXYGEN__)
+	struct {
+		/** Number of sequential page faults triggering read-ahead */
+		unsigned long			trigger;
+
+		/** Number of data pages loaded ahead of page faults */
+		unsigned long			pages;
+	} read_ahead;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -365,6 +375,49 @@ void k_mem_paging_backing_store_page_finalize(struct z_page_frame *pf,
  */
 void k_mem_paging_backing_store_init(void);
 
+#if defined(CONFIG_BACKING_STORE_COMPRESSED) || defined(__DOXYGEN__)
+/**
+ * Compressed RAM backing store statistics
+ */
+struct k_mem_paging_backing_store_compressed_stats {
+	/** Number of data pages stored */
+	unsigned long	pages;
+
+	/** Number of stored data pages filled with a single repeated word,
+	 * taking no room in the pool
+	 */
+	unsigned long	same_filled;
+
+	/** Number of stored data pages which didn't compress, stored as is */
+	unsigned long	incompressible;
+
+	/** Bytes of the pool used by the stored data pages, which take
+	 * pages * CONFIG_MMU_PAGE_SIZE bytes uncompressed
+	 */
+	size_t		compr_size;
+
+	/** Number of data pages paged out */
+	unsigned long	compressions;
+
+	/** Cycles spent paging out data pages, compressing them */
+	uint64_t	compress_cycles;
+
+	/** Number of data pages paged in */
+	unsigned long	decompressions;
+
+	/** Cycles spent paging in data pages, decompressing them */
+	uint64_t	decompress_cycles;
+};
+
+/**
+ * Get the compressed RAM backing store statistics
+ *
+ * @param stats Pointer to struct to copy statistics into
+ */
+void k_mem_paging_backing_store_compressed_stats_get(
+	struct k_mem_paging_backing_store_compressed_stats *stats);
+#endif /* CONFIG_BACKING_STORE_COMPRESSED */
+
 /** @} */
 
 #ifdef __cplusplus
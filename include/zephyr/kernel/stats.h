@@ -30,4 +30,34 @@ struct k_cycle_stats {
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+#if defined(CONFIG_SCHED_LATENCY_STATS) || defined(__DOXYGEN__)
+/**
+ * Histogram of scheduling latencies.
+ *
+ * Bucket 0 counts latencies below 1 us, bucket i latencies from 2^(i-1)
+ * up to 2^i us, and the last bucket all the longer ones.
+ */
+struct k_sched_latency_hist {
+	uint32_t  count;        /**< number of latencies measured */
+	uint32_t  max_ns;       /**< longest latency in ns */
+	uint64_t  total_ns;     /**< sum of the latencies in ns */
+	/** latency counts, by power of two of microseconds */
+	uint32_t  buckets[CONFIG_SCHED_LATENCY_STATS_BUCKETS];
+};
+
+/**
+ * Scheduling latencies of a thread, or of the threads of a priority.
+ */
+struct k_sched_latency_stats {
+	/** from being made ready to running */
+	struct k_sched_latency_hist wakeup;
+	/** from being made ready while of higher priority than the thread
+	 * running on the CPU making it ready, to running
+	 */
+	struct k_sched_latency_hist preempt;
+	/** from being made ready by an interrupt handler to running */
+	struct k_sched_latency_hist irq;
+};
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_STATS_H_ */
@@ -111,7 +111,9 @@ struct _thread_base {
 	/* True for the per-CPU idle threads */
 	uint8_t is_idle;
 
-	/* CPU index on which thread was last run */
+	/* CPU index on which thread was last run, or whose run queue
+	 * holds it with CONFIG_SCHED_PER_CPU_RUNQ
+	 */
 	uint8_t cpu;
 
 	/* Recursive count of irq_lock() calls */
@@ -145,6 +147,13 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	/* When the thread was made ready, 0 if it has run since */
+	uint32_t latency_start;
+	uint8_t latency_flags;
+	struct k_sched_latency_stats latency;
+#endif /* CONFIG_SCHED_LATENCY_STATS */
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -238,6 +247,15 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	/*
+	 * Scheduling latencies of the thread. When gathering statistics
+	 * for the system, those of all the priorities, as reported by
+	 * k_sched_latency_stats_get().
+	 */
+	struct k_sched_latency_stats latency;
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
@@ -164,7 +164,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -203,6 +203,13 @@ struct _cpu {
 	struct k_obj_core  obj_core;
 #endif
 
+#ifdef CONFIG_RCU
+	/* Count of quiescent states, i.e. of points where the CPU can't be
+	 * in a read-side critical section.
+	 */
+	atomic_t rcu_qs;
+#endif
+
 	/* Per CPU architecture specifics */
 	struct _cpu_arch arch;
 };
@@ -220,7 +227,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -250,8 +257,8 @@ struct z_kernel {
 #endif
 
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	/* Need to signal an IPI at the next scheduling point */
-	bool pending_ipi;
+	/* Bitmap of CPUs to signal an IPI at the next scheduling point */
+	atomic_t pending_ipi;
 #endif
 };
 
@@ -289,6 +296,15 @@ bool z_priq_rb_lessthan(struct rbnode *a, struct rbnode *b);
 
 #define Z_WAIT_Q_INIT(wait_q) { { { .lessthan_fn = z_priq_rb_lessthan } } }
 
+#elif defined(CONFIG_WAITQ_MULTIQ)
+
+typedef struct {
+	struct _priq_mq waitq;
+} _wait_q_t;
+
+/* An all-zero bitmask is an empty queue, lists are set up lazily */
+#define Z_WAIT_Q_INIT(wait_q) { { .bitmask = { 0 } } }
+
 #else
 
 typedef struct {
@@ -306,12 +322,23 @@ typedef void (*_timeout_func_t)(struct _timeout *t);
 struct _timeout {
 	sys_dnode_t node;
 	_timeout_func_t fn;
-#ifdef CONFIG_TIMEOUT_64BIT
+#if defined(CONFIG_TIMEOUT_QUEUE_WHEEL)
+	/* Absolute expiry, in timing wheel ticks */
+	uint64_t expiry;
+#elif defined(CONFIG_TIMEOUT_64BIT)
 	/* Can't use k_ticks_t for header dependency reasons */
 	int64_t dticks;
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* CPU whose queue the timeout is filed on */
+	uint8_t cpu;
+#endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks the timeout may expire late */
+	uint32_t slack;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
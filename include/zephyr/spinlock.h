@@ -78,8 +78,16 @@ struct k_spinlock {
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+	/* Statistics entry of the call site holding the lock, and the
+	 * timing counter value when the lock was taken there.
+	 */
+	void *stats_entry;
+	uint64_t stats_start;
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 #if defined(CONFIG_CPP) && !defined(CONFIG_SMP) && \
-	!defined(CONFIG_SPIN_VALIDATE)
+	!defined(CONFIG_SPIN_VALIDATE) && !defined(CONFIG_SPIN_LOCK_STATS)
 	/* If CONFIG_SMP and CONFIG_SPIN_VALIDATE are both not defined
 	 * the k_spinlock struct will have no members. The result
 	 * is that in C sizeof(k_spinlock) is 0 and in C++ it is 1.
@@ -116,6 +124,12 @@ bool z_spin_lock_mem_coherent(struct k_spinlock *l);
 
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+void z_spin_lock_stats_contended(struct k_spinlock *l);
+void z_spin_lock_stats_acquired(struct k_spinlock *l, bool contended);
+void z_spin_lock_stats_released(struct k_spinlock *l);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 /**
  * @brief Spinlock key type
  *
@@ -151,6 +165,35 @@ static ALWAYS_INLINE void z_spinlock_validate_post(struct k_spinlock *l)
 #endif /* CONFIG_SPIN_VALIDATE */
 }
 
+static ALWAYS_INLINE void z_spinlock_stats_spin(struct k_spinlock *l,
+						bool *contended)
+{
+	ARG_UNUSED(l);
+	ARG_UNUSED(contended);
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spin_lock_stats_contended(l);
+	*contended = true;
+#endif /* CONFIG_SPIN_LOCK_STATS */
+}
+
+static ALWAYS_INLINE void z_spinlock_stats_post(struct k_spinlock *l,
+						bool contended)
+{
+	ARG_UNUSED(l);
+	ARG_UNUSED(contended);
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spin_lock_stats_acquired(l, contended);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+}
+
+static ALWAYS_INLINE void z_spinlock_stats_release(struct k_spinlock *l)
+{
+	ARG_UNUSED(l);
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spin_lock_stats_released(l);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+}
+
 /**
  * @brief Lock a spinlock
  *
@@ -183,6 +226,7 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 {
 	ARG_UNUSED(l);
 	k_spinlock_key_t k;
+	bool contended = false;
 
 	/* Note that we need to use the underlying arch-specific lock
 	 * implementation.  The "irq_lock()" API in SMP context is
@@ -198,17 +242,27 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	 * receiving a ticket
 	 */
 	atomic_val_t ticket = atomic_inc(&l->tail);
+
+#ifdef CONFIG_SPIN_LOCK_STATS
+	if (atomic_get(&l->owner) != ticket) {
+		z_spinlock_stats_spin(l, &contended);
+	}
+#endif /* CONFIG_SPIN_LOCK_STATS */
 	/* Spin until our ticket is served */
 	while (atomic_get(&l->owner) != ticket) {
 		arch_spin_relax();
 	}
 #else
-	while (!atomic_cas(&l->locked, 0, 1)) {
-		arch_spin_relax();
+	if (!atomic_cas(&l->locked, 0, 1)) {
+		z_spinlock_stats_spin(l, &contended);
+		while (!atomic_cas(&l->locked, 0, 1)) {
+			arch_spin_relax();
+		}
 	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+	z_spinlock_stats_post(l, contended);
 
 	return k;
 }
@@ -264,6 +318,7 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+	z_spinlock_stats_post(l, false);
 
 	k->key = key;
 
@@ -312,6 +367,7 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 		 l, delta, CONFIG_SPIN_LOCK_TIME_LIMIT);
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
+	z_spinlock_stats_release(l);
 
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
@@ -362,6 +418,7 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
+	z_spinlock_stats_release(l);
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	atomic_inc(&l->owner);
@@ -439,6 +496,213 @@ static ALWAYS_INLINE void z_spin_onexit(__maybe_unused k_spinlock_key_t *k)
 	for (k_spinlock_key_t __i K_SPINLOCK_ONEXIT = {}, __key = k_spin_lock(lck); !__i.key;      \
 	     k_spin_unlock(lck, __key), __i.key = 1)
 
+#if defined(CONFIG_SPIN_LOCK_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Spinlock call site statistics
+ *
+ * Statistics of the spinlocks taken from one call site, gathered with
+ * CONFIG_SPIN_LOCK_STATS. Times are in timing function cycles, see
+ * timing_cycles_to_ns().
+ */
+struct k_spinlock_stats {
+	/** Address of the code taking the lock */
+	void *site;
+	/** Last lock taken there */
+	struct k_spinlock *lock;
+	/** Number of times a lock was taken there */
+	uint32_t acquired;
+	/** Number of those times the lock was held by another CPU */
+	uint32_t contended;
+	/** Total time the lock was held */
+	uint64_t hold_cycles;
+	/** Longest time the lock was held */
+	uint64_t hold_cycles_max;
+	/** Total time spent spinning on the lock */
+	uint64_t spin_cycles;
+	/** Longest time spent spinning on the lock */
+	uint64_t spin_cycles_max;
+};
+
+/**
+ * @brief Spinlock statistics callback
+ *
+ * @param stats Statistics of a call site
+ * @param user_data User data passed to k_spinlock_stats_foreach()
+ */
+typedef void (*k_spinlock_stats_cb_t)(const struct k_spinlock_stats *stats,
+				      void *user_data);
+
+/**
+ * @brief Iterate over the spinlock call site statistics
+ *
+ * Invokes @p cb with a snapshot of the statistics of each call site that
+ * took a spinlock since boot. It is called without any lock held.
+ *
+ * @param cb Callback
+ * @param user_data User data passed to @p cb
+ */
+void k_spinlock_stats_foreach(k_spinlock_stats_cb_t cb, void *user_data);
+
+/**
+ * @brief Reset the spinlock statistics
+ *
+ * Clears the statistics of all call sites, and the count of dropped
+ * acquisitions.
+ */
+void k_spinlock_stats_reset(void);
+
+/**
+ * @brief Get the number of acquisitions that were not recorded
+ *
+ * Locks taken from call sites for which no statistics entry was left, see
+ * CONFIG_SPIN_LOCK_STATS_ENTRIES, are only counted.
+ *
+ * @return Number of acquisitions not recorded since boot or the last reset
+ */
+uint32_t k_spinlock_stats_dropped(void);
+
+/**
+ * @brief Emit the spinlock statistics as tracing events
+ *
+ * Emits one event per call site with the tracing backend, for example as
+ * CTF spinlock_stats events.
+ */
+void k_spinlock_stats_trace(void);
+#endif /* CONFIG_SPIN_LOCK_STATS || __DOXYGEN__ */
+
+/**
+ * @brief Kernel Spin Reader-Writer Lock
+ *
+ * This struct defines a spinning reader-writer lock. Any number of CPUs
+ * may hold it for reading with k_spin_read_lock() at the same time,
+ * while k_spin_write_lock() grants exclusive access to a single CPU.
+ * A CPU waiting to lock it for writing keeps new readers out, so that
+ * writers are not starved by a steady stream of readers.
+ */
+struct k_spin_rwlock {
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#ifdef CONFIG_SMP
+	/* Number of readers, plus Z_SPIN_RWLOCK_WRITER once a writer
+	 * has claimed the lock.
+	 */
+	atomic_t state;
+#elif defined(CONFIG_CPP)
+	/* See struct k_spinlock */
+	char dummy;
+#endif /* CONFIG_SMP */
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_SPIN_RWLOCK_WRITER ((atomic_val_t)1 << 30)
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Lock a spin reader-writer lock for reading
+ *
+ * Like k_spin_lock(), this masks interrupts on the current CPU until
+ * the matching k_spin_read_unlock(), so the lock may be taken from
+ * ISRs. Other CPUs may hold the lock for reading at the same time, but
+ * not for writing. Read locks are not recursive: a CPU that tries to
+ * lock for reading a lock it already holds may deadlock with a waiting
+ * writer.
+ *
+ * @param l A pointer to the reader-writer lock
+ * @return A key value that must be passed to k_spin_read_unlock()
+ */
+static ALWAYS_INLINE k_spinlock_key_t k_spin_read_lock(struct k_spin_rwlock *l)
+{
+	ARG_UNUSED(l);
+	k_spinlock_key_t k;
+
+	k.key = arch_irq_lock();
+
+#ifdef CONFIG_SMP
+	while (true) {
+		atomic_val_t state = atomic_get(&l->state);
+
+		if (((state & Z_SPIN_RWLOCK_WRITER) == 0) &&
+		    atomic_cas(&l->state, state, state + 1)) {
+			break;
+		}
+		arch_spin_relax();
+	}
+#endif /* CONFIG_SMP */
+
+	return k;
+}
+
+/**
+ * @brief Unlock a spin reader-writer lock locked for reading
+ *
+ * @param l A pointer to the reader-writer lock
+ * @param key The value returned from k_spin_read_lock()
+ */
+static ALWAYS_INLINE void k_spin_read_unlock(struct k_spin_rwlock *l,
+					     k_spinlock_key_t key)
+{
+	ARG_UNUSED(l);
+#ifdef CONFIG_SMP
+	(void)atomic_dec(&l->state);
+#endif /* CONFIG_SMP */
+	arch_irq_unlock(key.key);
+}
+
+/**
+ * @brief Lock a spin reader-writer lock for writing
+ *
+ * Claims the lock, which keeps new readers out, then spins until the
+ * current readers have released it. Upon returning, the calling CPU
+ * has exclusive access to the lock and interrupts are masked on it
+ * until the matching k_spin_write_unlock().
+ *
+ * @param l A pointer to the reader-writer lock
+ * @return A key value that must be passed to k_spin_write_unlock()
+ */
+static ALWAYS_INLINE k_spinlock_key_t k_spin_write_lock(struct k_spin_rwlock *l)
+{
+	ARG_UNUSED(l);
+	k_spinlock_key_t k;
+
+	k.key = arch_irq_lock();
+
+#ifdef CONFIG_SMP
+	while ((atomic_or(&l->state, Z_SPIN_RWLOCK_WRITER) &
+		Z_SPIN_RWLOCK_WRITER) != 0) {
+		arch_spin_relax();
+	}
+	while (atomic_get(&l->state) != Z_SPIN_RWLOCK_WRITER) {
+		arch_spin_relax();
+	}
+#endif /* CONFIG_SMP */
+
+	return k;
+}
+
+/**
+ * @brief Unlock a spin reader-writer lock locked for writing
+ *
+ * @param l A pointer to the reader-writer lock
+ * @param key The value returned from k_spin_write_lock()
+ */
+static ALWAYS_INLINE void k_spin_write_unlock(struct k_spin_rwlock *l,
+					      k_spinlock_key_t key)
+{
+	ARG_UNUSED(l);
+#ifdef CONFIG_SMP
+	(void)atomic_clear(&l->state);
+#endif /* CONFIG_SMP */
+	arch_irq_unlock(key.key);
+}
+
 /** @} */
 
 #ifdef __cplusplus
@@ -11,9 +11,10 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
- * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
+ * With CONFIG_SYS_MUTEX_FAST_PATH, uncontended sys_mutexes are locked and
+ * unlocked with simple atomic ops instead of syscalls, similar to Linux's
+ * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI: the kernel is only entered to wait
+ * for, or hand over, a mutex other threads are waiting on.
  */
 
 #ifdef __cplusplus
@@ -24,15 +25,26 @@ extern "C" {
 #include <zephyr/sys/atomic.h>
 #include <zephyr/types.h>
 #include <zephyr/sys_clock.h>
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+#include <errno.h>
+#include <zephyr/kernel.h>
+#endif
 
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* With CONFIG_SYS_MUTEX_FAST_PATH, ID of the owner thread (0 if
+	 * unlocked), or'ed with SYS_MUTEX_CONTENDED once threads have to
+	 * wait for it in the kernel. Unused otherwise.
 	 */
 	atomic_t val;
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	/* Recursive lock count, only ever accessed by the owner */
+	uint32_t lock_count;
+#endif
 };
 
+/* Set in sys_mutex::val when unlocking needs to go through the kernel */
+#define SYS_MUTEX_CONTENDED ((atomic_val_t)1)
+
 /**
  * @defgroup user_mutex_apis User mode mutex APIs
  * @ingroup kernel_apis
@@ -67,10 +79,15 @@ struct sys_mutex {
  */
 static inline void sys_mutex_init(struct sys_mutex *mutex)
 {
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_clear(&mutex->val);
+	mutex->lock_count = 0U;
+#else
 	ARG_UNUSED(mutex);
+#endif
 
-	/* Nothing to do, kernel-side data structures are initialized at
-	 * boot
+	/* Nothing else to do, kernel-side data structures are initialized
+	 * at boot
 	 */
 }
 
@@ -98,11 +115,42 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  * @retval -EAGAIN Waiting period timed out.
  * @retval -EACCES Caller has no access to provided mutex address
  * @retval -EINVAL Provided mutex not recognized by the kernel
+ *
+ * @note With CONFIG_SYS_MUTEX_FAST_PATH, an uncontended mutex is locked
+ *       without a system call, so -EACCES and -EINVAL are only reported
+ *       when the kernel has to be entered.
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	atomic_val_t owner;
+	int ret;
+
+	if (likely(atomic_cas(&mutex->val, 0, self))) {
+		mutex->lock_count = 1U;
+		return 0;
+	}
+
+	owner = atomic_get(&mutex->val) & ~SYS_MUTEX_CONTENDED;
+	if (owner == self) {
+		mutex->lock_count++;
+		return 0;
+	}
+
+	if (owner != 0 && K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -EBUSY;
+	}
+
+	ret = z_sys_mutex_kernel_lock(mutex, timeout);
+	if (ret == 0) {
+		mutex->lock_count = 1U;
+	}
+
+	return ret;
+#else
 	return z_sys_mutex_kernel_lock(mutex, timeout);
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
 }
 
 /**
@@ -121,11 +169,39 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  * @retval -EINVAL Provided mutex not recognized by the kernel or mutex wasn't
  *                 locked
  * @retval -EPERM Caller does not own the mutex
+ *
+ * @note With CONFIG_SYS_MUTEX_FAST_PATH, a mutex no other thread is
+ *       waiting on is unlocked without a system call.
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	atomic_val_t val = atomic_get(&mutex->val);
+
+	if (val == 0) {
+		return -EINVAL;
+	}
+
+	if ((val & ~SYS_MUTEX_CONTENDED) != self) {
+		return -EPERM;
+	}
+
+	if (mutex->lock_count > 1U) {
+		mutex->lock_count--;
+		return 0;
+	}
+
+	mutex->lock_count = 0U;
+	if (likely(atomic_cas(&mutex->val, self, 0))) {
+		return 0;
+	}
+
+	/* Waiters: let the kernel hand the mutex over */
+	return z_sys_mutex_kernel_unlock(mutex);
+#else
 	return z_sys_mutex_kernel_unlock(mutex);
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
 }
 
 #include <syscalls/mutex.h>
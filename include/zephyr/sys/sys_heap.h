@@ -44,6 +44,10 @@ extern "C" {
  * extreme values results in an effectively linear search of the
  * list), objectively fast (~hundred instructions) and and amenable to
  * locked operation.
+ *
+ * Optional small object front end.  With CONFIG_SYS_HEAP_SMALL_OBJECTS,
+ * small allocations come from power-of-two size classes packed into
+ * pages taken from the heap, with no per-object header.
  */
 
 /* Note: the init_mem/bytes fields are for the static initializer to
@@ -150,6 +154,42 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes);
  */
 void sys_heap_free(struct sys_heap *heap, void *mem);
 
+/** @brief Allocate several blocks from a sys_heap
+ *
+ * Allocates @a count blocks of @a bytes bytes each, as if by as many
+ * calls to sys_heap_alloc().  Either all the blocks are allocated or
+ * none of them are.  Each block can then be freed on its own with
+ * sys_heap_free(), or with the other ones with sys_heap_free_n().
+ *
+ * @note The sys_heap implementation is not internally synchronized.
+ * No two sys_heap functions should operate on the same heap at the
+ * same time.  All locking must be provided by the user.
+ *
+ * @param heap Heap from which to allocate
+ * @param mem Array receiving the @a count block pointers
+ * @param count Number of blocks requested
+ * @param bytes Number of bytes requested for each block
+ * @return 0 on success, -ENOMEM if the blocks could not all be allocated
+ */
+int sys_heap_alloc_n(struct sys_heap *heap, void **mem, size_t count,
+		     size_t bytes);
+
+/** @brief Free several blocks into a sys_heap
+ *
+ * De-allocates the @a count blocks pointed to by @a mem, as if by as many
+ * calls to sys_heap_free().
+ *
+ * @note The sys_heap implementation is not internally synchronized.
+ * No two sys_heap functions should operate on the same heap at the
+ * same time.  All locking must be provided by the user.
+ *
+ * @param heap Heap to which to return the memory
+ * @param mem Array of pointers previously returned from sys_heap_alloc()
+ * or sys_heap_alloc_n()
+ * @param count Number of blocks to free
+ */
+void sys_heap_free_n(struct sys_heap *heap, void **mem, size_t count);
+
 /** @brief Expand the size of an existing allocation
  *
  * Returns a pointer to a new memory region with the same contents,
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Batched system calls
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup syscall_batch_apis Batched System Call APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Batched system call descriptor
+ *
+ * Describes one system call of a batch submitted with k_syscall_batch().
+ * The arguments are laid out the way the system call's own stub passes
+ * them: 64-bit arguments are split into their lower and higher words on
+ * 32-bit targets, and system calls returning 64-bit values on 32-bit
+ * targets take a pointer to the return value as an extra last argument.
+ */
+struct k_syscall_desc {
+	/** System call ID, one of the K_SYSCALL_* values */
+	uintptr_t id;
+	/** System call arguments, unused ones are ignored */
+	uintptr_t args[6];
+	/** Return value of the system call, set by k_syscall_batch() */
+	uintptr_t ret;
+};
+
+/**
+ * @brief Invoke several system calls at once
+ *
+ * Runs the system calls described by @a descs in order, with a single
+ * privilege elevation, and stores the value returned by each of them in
+ * its descriptor. Each system call is verified exactly as if it was
+ * invoked on its own: a system call failing its verification, or an
+ * invalid system call ID, kills the calling thread after the preceding
+ * entries of the batch have run.
+ *
+ * Batching is only meaningful for user threads, supervisor threads
+ * should invoke the APIs directly.
+ *
+ * @param descs Array of system call descriptors
+ * @param count Number of descriptors in @a descs
+ *
+ * @retval 0 All the system calls of the batch have run
+ * @retval -ENOTSUP Called from supervisor mode
+ */
+__syscall int k_syscall_batch(struct k_syscall_desc *descs, size_t count);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <syscalls/syscall_batch.h>
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
@@ -141,6 +141,38 @@ typedef struct {
  */
 #define Z_TICK_ABS(t) (K_TICKS_FOREVER - 1 - (t))
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/* The slack of a relative timeout is packed above its tick count,
+ * which leaves 2^44 ticks for the timeout itself.  Longer timeouts
+ * can't carry any slack.
+ */
+#define Z_TICK_SLACK_SHIFT 44
+#define Z_TICK_SLACK_MASK (((k_ticks_t)1 << Z_TICK_SLACK_SHIFT) - 1)
+#define Z_TICK_SLACK_MAX (((k_ticks_t)1 << (63 - Z_TICK_SLACK_SHIFT)) - 1)
+
+/* Slack of a timeout tick count, and the tick count without it */
+#define Z_TICK_SLACK(t) ((t) > 0 ? ((t) >> Z_TICK_SLACK_SHIFT) : 0)
+#define Z_TICK_NO_SLACK(t) ((t) > 0 ? ((t) & Z_TICK_SLACK_MASK) : (t))
+
+static inline k_timeout_t z_timeout_slack(k_timeout_t timeout,
+					  k_timeout_t slack)
+{
+	k_ticks_t ticks = Z_TICK_NO_SLACK(timeout.ticks);
+	k_ticks_t s = (slack.ticks < 0) ? Z_TICK_SLACK_MAX
+		: MIN(Z_TICK_NO_SLACK(slack.ticks), Z_TICK_SLACK_MAX);
+
+	if ((ticks > 0) && (ticks <= Z_TICK_SLACK_MASK)) {
+		ticks |= s << Z_TICK_SLACK_SHIFT;
+	}
+
+	return Z_TIMEOUT_TICKS(ticks);
+}
+#else
+#define Z_TICK_SLACK(t) 0
+#define Z_TICK_NO_SLACK(t) (t)
+#define z_timeout_slack(timeout, slack) (timeout)
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /* added tick needed to account for tick in progress */
 #define _TICK_ALIGN 1
 
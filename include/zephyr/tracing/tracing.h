@@ -1898,6 +1898,20 @@
 
 /** @} */ /* end of subsys_tracing_apis_event */
 
+/**
+ * @brief Spinlock Tracing APIs
+ * @defgroup subsys_tracing_apis_spinlock Spinlock Tracing APIs
+ * @{
+ */
+
+/**
+ * @brief Trace the statistics of a spinlock call site
+ * @param stats Call site statistics, see k_spinlock_stats_trace()
+ */
+#define sys_port_trace_k_spinlock_stats(stats)
+
+/** @} */ /* end of subsys_tracing_apis_spinlock */
+
 /**
  * @brief System PM Tracing APIs
  * @defgroup subsys_tracing_apis_pm_system System PM Tracing APIs
@@ -5,7 +5,9 @@
  */
 #include <zephyr/kernel.h>
 #include <ksched.h>
+#include <timeout_q.h>
 #include <zephyr/spinlock.h>
+#include <zephyr/sys/math_extras.h>
 
 extern struct k_spinlock _sched_spinlock;
 
@@ -41,6 +43,20 @@ static int cpu_mask_mod(k_tid_t thread, uint32_t enable_mask, uint32_t disable_m
 			 "Only one CPU allowed in mask when PIN_ONLY");
 #endif /* defined(CONFIG_ASSERT) && defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) */
 
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* Have a pending timeout expire on a CPU the thread may run on */
+	uint32_t mask = thread->base.cpu_mask;
+
+	if ((ret == 0) && (mask != 0) &&
+	    ((mask & BIT(thread->base.timeout.cpu)) == 0)) {
+		int cpu = u32_count_trailing_zeros(mask);
+
+		if (cpu < CONFIG_MP_MAX_NUM_CPUS) {
+			z_move_timeout(&thread->base.timeout, cpu);
+		}
+	}
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
 	return ret;
 }
 
@@ -110,6 +110,17 @@ static inline void *z_thread_malloc(size_t size)
 	return z_thread_aligned_alloc(0, size);
 }
 
+#ifdef CONFIG_HEAP_MEM_POOL_CPU_CACHE
+/**
+ * @brief Get the number of bytes held by the k_malloc() per-CPU caches
+ *
+ * @param heap Heap the blocks were allocated from
+ * @return Usable size of the blocks cached for @a heap, 0 if it is not
+ * the system heap
+ */
+size_t z_heap_cpu_cache_bytes(struct sys_heap *heap);
+#endif
+
 
 #ifdef CONFIG_USE_SWITCH
 /* This is a arch function traditionally, but when the switch-based
@@ -222,6 +233,13 @@ void z_mem_manage_boot_finish(void);
 
 void z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state);
 
+#ifdef CONFIG_QUEUE_LOCKLESS
+/* Same as z_handle_obj_poll_events() for a lockless k_queue, also
+ * clearing its Z_QUEUE_LOCKLESS_POLLED flag once no events are left.
+ */
+void z_handle_queue_poll_events(struct k_queue *queue, uint32_t state);
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 #ifdef CONFIG_PM
 
 /* When the kernel is about to go idle, it calls this function to notify the
@@ -293,6 +293,18 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+/*
+ * Record when a thread is made ready, with the scheduler lock held, and
+ * account for the time it took to run when it is switched in.
+ */
+void z_sched_latency_ready(struct k_thread *thread);
+void z_sched_latency_switch(struct k_thread *thread);
+
+/* Sum of the scheduling latencies of all priorities */
+void z_sched_latency_all(struct k_sched_latency_stats *stats);
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
@@ -300,6 +312,21 @@ static inline void z_sched_usage_switch(struct k_thread *thread)
 	z_sched_usage_stop();
 	z_sched_usage_start(thread);
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	z_sched_latency_switch(thread);
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+}
+
+/*
+ * Report a quiescent state of the current CPU: a point where it can't be
+ * in an RCU read-side critical section, as these mask interrupts. Called
+ * when scheduling, i.e. on context switches and interrupt exits.
+ */
+static inline void z_rcu_quiescent_state(void)
+{
+#ifdef CONFIG_RCU
+	(void)atomic_inc(&_current_cpu->rcu_qs);
+#endif /* CONFIG_RCU */
 }
 
 #endif /* ZEPHYR_KERNEL_INCLUDE_KSCHED_H_ */
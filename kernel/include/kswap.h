@@ -121,6 +121,8 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 
 	new_thread = z_swap_next_thread();
 
+	z_rcu_quiescent_state();
+
 	if (new_thread != old_thread) {
 		z_sched_usage_switch(new_thread);
 
@@ -19,6 +19,7 @@ bool z_priq_rb_lessthan(struct rbnode *a, struct rbnode *b);
 #if defined(CONFIG_SCHED_DUMB)
 #define _priq_run_add		z_priq_dumb_add
 #define _priq_run_remove	z_priq_dumb_remove
+#define _priq_run_head		z_priq_dumb_best
 # if defined(CONFIG_SCHED_CPU_MASK)
 #  define _priq_run_best	z_priq_dumb_mask_best
 # else
@@ -29,20 +30,13 @@ bool z_priq_rb_lessthan(struct rbnode *a, struct rbnode *b);
 #define _priq_run_add		z_priq_rb_add
 #define _priq_run_remove	z_priq_rb_remove
 #define _priq_run_best		z_priq_rb_best
+#define _priq_run_head		z_priq_rb_best
  /* Multi Queue Scheduling */
 #elif defined(CONFIG_SCHED_MULTIQ)
-
-#if defined(CONFIG_64BIT)
-#define NBITS 64
-#else
-#define NBITS 32
-#endif /* CONFIG_64BIT */
-
 #define _priq_run_add		z_priq_mq_add
 #define _priq_run_remove	z_priq_mq_remove
 #define _priq_run_best		z_priq_mq_best
-static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq, struct k_thread *thread);
-static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq, struct k_thread *thread);
+#define _priq_run_head		z_priq_mq_best
 #endif
 
 /* Scalable Wait Queue */
@@ -50,6 +44,11 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq, struct k_thread
 #define _priq_wait_add		z_priq_rb_add
 #define _priq_wait_remove	z_priq_rb_remove
 #define _priq_wait_best		z_priq_rb_best
+/* Multi Queue Wait Queue */
+#elif defined(CONFIG_WAITQ_MULTIQ)
+#define _priq_wait_add		z_priq_mq_add
+#define _priq_wait_remove	z_priq_mq_remove
+#define _priq_wait_best		z_priq_mq_best
 /* Dumb Wait Queue */
 #elif defined(CONFIG_WAITQ_DUMB)
 #define _priq_wait_add		z_priq_dumb_add
@@ -57,6 +56,14 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq, struct k_thread
 #define _priq_wait_best		z_priq_dumb_best
 #endif
 
+#if defined(CONFIG_SCHED_MULTIQ) || defined(CONFIG_WAITQ_MULTIQ)
+#if defined(CONFIG_64BIT)
+#define NBITS 64
+#else
+#define NBITS 32
+#endif /* CONFIG_64BIT */
+#endif /* CONFIG_SCHED_MULTIQ || CONFIG_WAITQ_MULTIQ */
+
 static ALWAYS_INLINE void z_priq_dumb_remove(sys_dlist_t *pq, struct k_thread *thread)
 {
 	ARG_UNUSED(pq);
@@ -141,8 +148,7 @@ static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 	return thread;
 }
 
-
-#ifdef CONFIG_SCHED_MULTIQ
+#if defined(CONFIG_SCHED_MULTIQ) || defined(CONFIG_WAITQ_MULTIQ)
 
 struct prio_info {
 	uint8_t offset_prio;
@@ -161,13 +167,47 @@ static ALWAYS_INLINE struct prio_info get_prio_info(int8_t old_prio)
 	return ret;
 }
 
+/* The per-priority lists are only valid while their bit is set in
+ * the bitmask, so that a zeroed struct _priq_mq is an empty queue
+ * (wait queues can be statically initialized that way).
+ */
 static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
 					struct k_thread *thread)
 {
 	struct prio_info pos = get_prio_info(thread->base.prio);
+	sys_dlist_t *l = &pq->queues[pos.offset_prio];
+
+	if ((pq->bitmask[pos.idx] & BIT(pos.bit)) == 0U) {
+		sys_dlist_init(l);
+		pq->bitmask[pos.idx] |= BIT(pos.bit);
+	}
+
+#ifdef CONFIG_SCHED_DEADLINE
+	/* Threads of a given priority are ordered by deadline, FIFO
+	 * for equal deadlines.  Search from the tail, so that the
+	 * common case of deadlines increasing with insertion order
+	 * stays constant time.
+	 */
+	sys_dnode_t *n;
 
-	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
-	pq->bitmask[pos.idx] |= BIT(pos.bit);
+	for (n = sys_dlist_peek_tail(l); n != NULL;
+	     n = sys_dlist_peek_prev(l, n)) {
+		struct k_thread *t = CONTAINER_OF(n, struct k_thread,
+						  base.qnode_dlist);
+
+		if (z_sched_prio_cmp(thread, t) <= 0) {
+			break;
+		}
+	}
+
+	n = (n == NULL) ? sys_dlist_peek_head(l) : sys_dlist_peek_next(l, n);
+	if (n != NULL) {
+		sys_dlist_insert(n, &thread->base.qnode_dlist);
+		return;
+	}
+#endif /* CONFIG_SCHED_DEADLINE */
+
+	sys_dlist_append(l, &thread->base.qnode_dlist);
 }
 
 static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
@@ -180,7 +220,45 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
 		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
 	}
 }
-#endif /* CONFIG_SCHED_MULTIQ */
+
+/* Thread following a queued one in priority order, for iteration */
+static ALWAYS_INLINE struct k_thread *z_priq_mq_next(struct _priq_mq *pq,
+						     struct k_thread *thread)
+{
+	struct prio_info pos = get_prio_info(thread->base.prio);
+	sys_dnode_t *n = sys_dlist_peek_next(&pq->queues[pos.offset_prio],
+					     &thread->base.qnode_dlist);
+
+	if (n != NULL) {
+		return CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+	}
+
+	for (int i = pos.idx; i < PRIQ_BITMAP_SIZE; i++) {
+#ifdef CONFIG_64BIT
+		uint64_t bits = pq->bitmask[i];
+#else
+		uint32_t bits = pq->bitmask[i];
+#endif
+
+		/* Only the priorities after this one, in its word */
+		if (i == pos.idx) {
+			bits &= ~(BIT_MASK(pos.bit) | BIT(pos.bit));
+		}
+		if (bits == 0U) {
+			continue;
+		}
+
+#ifdef CONFIG_64BIT
+		n = sys_dlist_peek_head(&pq->queues[i * 64 + u64_count_trailing_zeros(bits)]);
+#else
+		n = sys_dlist_peek_head(&pq->queues[i * 32 + u32_count_trailing_zeros(bits)]);
+#endif
+		return CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_SCHED_MULTIQ || CONFIG_WAITQ_MULTIQ */
 
 
 
@@ -25,11 +25,31 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	to->cpu = 0;
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 }
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Adds a timeout allowed to expire up to slack ticks late, whatever
+ * the kind of timeout.
+ */
+void z_add_timeout_slack(struct _timeout *to, _timeout_func_t fn,
+			 k_timeout_t timeout, k_ticks_t slack);
+#else
+static inline void z_add_timeout_slack(struct _timeout *to,
+				       _timeout_func_t fn,
+				       k_timeout_t timeout, k_ticks_t slack)
+{
+	ARG_UNUSED(slack);
+
+	z_add_timeout(to, fn, timeout);
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 int z_abort_timeout(struct _timeout *to);
 
 static inline bool z_is_inactive_timeout(const struct _timeout *to)
@@ -58,6 +78,16 @@ int32_t z_get_next_timeout_expiry(void);
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout);
 
+#ifdef CONFIG_TIMEOUT_PER_CPU
+/* Expires the due timeouts queued on the current CPU, called from
+ * the scheduler IPI.
+ */
+void z_timeout_ipi(void);
+
+/* Moves a timeout, if pending, to the queue of another CPU */
+void z_move_timeout(struct _timeout *to, int cpu);
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
 #else
 
 /* Stubs when !CONFIG_SYS_CLOCK_EXISTS */
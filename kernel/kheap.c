@@ -129,3 +129,41 @@ void k_heap_free(struct k_heap *heap, void *mem)
 		k_spin_unlock(&heap->lock, key);
 	}
 }
+
+int k_heap_alloc_n(struct k_heap *heap, void **mem, size_t count, size_t bytes,
+		   k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+	bool may_wait = IS_ENABLED(CONFIG_MULTITHREADING) &&
+			!K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+	int ret;
+
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	ret = sys_heap_alloc_n(&heap->heap, mem, count, bytes);
+
+	while ((ret != 0) && may_wait && !sys_timepoint_expired(end)) {
+		timeout = sys_timepoint_timeout(end);
+		(void) z_pend_curr(&heap->lock, key, &heap->wait_q, timeout);
+		key = k_spin_lock(&heap->lock);
+		ret = sys_heap_alloc_n(&heap->heap, mem, count, bytes);
+	}
+
+	k_spin_unlock(&heap->lock, key);
+
+	return ((ret != 0) && may_wait) ? -EAGAIN : ret;
+}
+
+void k_heap_free_n(struct k_heap *heap, void **mem, size_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+	sys_heap_free_n(&heap->heap, mem, count);
+
+	if (IS_ENABLED(CONFIG_MULTITHREADING) && z_unpend_all(&heap->wait_q) != 0) {
+		z_reschedule(&heap->lock, key);
+	} else {
+		k_spin_unlock(&heap->lock, key);
+	}
+}
@@ -48,9 +48,9 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
+	ptr->allocated_bytes = k_mem_slab_num_used_get(slab) *
+			       slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
@@ -72,9 +72,17 @@ static int k_mem_slab_stats_reset(struct k_obj_core *obj_core)
 	key = k_spin_lock(&slab->lock);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		slab->info.cpu_stats[i].hits = 0U;
+		slab->info.cpu_stats[i].refills = 0U;
+		slab->info.cpu_stats[i].flushes = 0U;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -92,6 +100,126 @@ static struct k_obj_core_stats_desc mem_slab_stats_desc = {
 #endif /* CONFIG_OBJ_CORE_STATS_MEM_SLAB */
 #endif /* CONFIG_OBJ_CORE_MEM_SLAB */
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/* Number of blocks moved between a CPU cache and the slab at once */
+#define CPU_CACHE_BATCH (CONFIG_MEM_SLAB_CPU_CACHE_SIZE / 2)
+
+static inline void trace_max_used(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	/* Not synchronized with the other CPUs, so only exact as long as
+	 * they don't use the slab concurrently.
+	 */
+	slab->info.max_used = MAX(k_mem_slab_num_used_get(slab),
+				  slab->info.max_used);
+#else
+	ARG_UNUSED(slab);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+}
+
+/* Allocate a block from the cache of the current CPU.
+ *
+ * The cache of a CPU is only ever accessed from that CPU with interrupts
+ * locked, no other synchronization is needed.
+ *
+ * @return true if a block was allocated, false if the cache is empty.
+ */
+static bool cpu_cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	unsigned int key = arch_irq_lock();
+	uint8_t cpu = _current_cpu->id;
+	char *block = slab->cpu_free_list[cpu];
+
+	if (block != NULL) {
+		slab->cpu_free_list[cpu] = *(char **)block;
+		slab->info.cpu_stats[cpu].num_cached--;
+		slab->info.cpu_stats[cpu].hits++;
+		trace_max_used(slab);
+		*mem = block;
+	}
+
+	arch_irq_unlock(key);
+
+	return block != NULL;
+}
+
+/* Free a block to the cache of the current CPU.
+ *
+ * Blocks go to the slab itself when the cache is full, and when the slab
+ * free list is empty or threads wait in k_mem_slab_alloc_n(), since they
+ * may then be waiting for a block.
+ *
+ * @return true if the block was freed, false if the slab must be used.
+ */
+static bool cpu_cache_free(struct k_mem_slab *slab, void *mem)
+{
+	unsigned int key = arch_irq_lock();
+	uint8_t cpu = _current_cpu->id;
+	bool cached = (slab->free_list != NULL) &&
+		(slab->info.cpu_stats[cpu].num_cached < CONFIG_MEM_SLAB_CPU_CACHE_SIZE) &&
+		(z_waitq_head(&slab->wait_n_q) == NULL);
+
+	if (cached) {
+		*(char **)mem = slab->cpu_free_list[cpu];
+		slab->cpu_free_list[cpu] = mem;
+		slab->info.cpu_stats[cpu].num_cached++;
+		slab->info.cpu_stats[cpu].hits++;
+	}
+
+	arch_irq_unlock(key);
+
+	return cached;
+}
+
+/* Fill the current CPU cache with up to CPU_CACHE_BATCH blocks from the slab.
+ *
+ * Invoked with slab lock held.
+ */
+static void cpu_cache_refill_locked(struct k_mem_slab *slab)
+{
+	uint8_t cpu = _current_cpu->id;
+	uint32_t n;
+
+	for (n = slab->info.cpu_stats[cpu].num_cached;
+	     (n < CPU_CACHE_BATCH) && (slab->free_list != NULL); n++) {
+		char *block = slab->free_list;
+
+		slab->free_list = *(char **)block;
+		*(char **)block = slab->cpu_free_list[cpu];
+		slab->cpu_free_list[cpu] = block;
+	}
+
+	slab->info.num_used += n - slab->info.cpu_stats[cpu].num_cached;
+	slab->info.cpu_stats[cpu].num_cached = n;
+	slab->info.cpu_stats[cpu].refills++;
+}
+
+/* Move CPU_CACHE_BATCH blocks from a full current CPU cache to the slab.
+ *
+ * Invoked with slab lock held.
+ */
+static void cpu_cache_flush_locked(struct k_mem_slab *slab)
+{
+	uint8_t cpu = _current_cpu->id;
+
+	if (slab->info.cpu_stats[cpu].num_cached < CONFIG_MEM_SLAB_CPU_CACHE_SIZE) {
+		return;
+	}
+
+	for (uint32_t n = 0U; n < CPU_CACHE_BATCH; n++) {
+		char *block = slab->cpu_free_list[cpu];
+
+		slab->cpu_free_list[cpu] = *(char **)block;
+		*(char **)block = slab->free_list;
+		slab->free_list = block;
+	}
+
+	slab->info.num_used -= CPU_CACHE_BATCH;
+	slab->info.cpu_stats[cpu].num_cached -= CPU_CACHE_BATCH;
+	slab->info.cpu_stats[cpu].flushes++;
+}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 /**
  * @brief Initialize kernel memory slab subsystem.
  *
@@ -180,6 +308,11 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->info.num_used = 0U;
 	slab->lock = (struct k_spinlock) {};
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	(void)memset(slab->cpu_free_list, 0, sizeof(slab->cpu_free_list));
+	(void)memset(slab->info.cpu_stats, 0, sizeof(slab->info.cpu_stats));
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
@@ -198,6 +331,7 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 #endif /* CONFIG_OBJ_CORE_STATS_MEM_SLAB */
 
 	z_waitq_init(&slab->wait_q);
+	z_waitq_init(&slab->wait_n_q);
 	k_object_init(slab);
 out:
 	SYS_PORT_TRACING_OBJ_INIT(k_mem_slab, slab, rc);
@@ -207,6 +341,15 @@ out:
 
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cpu_cache_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 	int result;
 
@@ -218,10 +361,14 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 		slab->free_list = *(char **)(slab->free_list);
 		slab->info.num_used++;
 
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		/* and stock up for the next allocations */
+		cpu_cache_refill_locked(slab);
+		trace_max_used(slab);
+#elif defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION)
 		slab->info.max_used = MAX(slab->info.num_used,
 					  slab->info.max_used);
-#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
@@ -250,15 +397,42 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 	return result;
 }
 
+static inline bool block_is_valid(struct k_mem_slab *slab, void *mem)
+{
+	return ((char *)mem >= slab->buffer) &&
+	       ((((char *)mem - slab->buffer) % slab->info.block_size) == 0) &&
+	       ((char *)mem <= (slab->buffer + (slab->info.block_size *
+						(slab->info.num_blocks - 1))));
+}
+
+/* Wake the threads waiting in k_mem_slab_alloc_n(), after blocks were
+ * put back in the free list, for them to retry their allocation.
+ *
+ * Invoked with slab lock held.
+ *
+ * @return true if a waiting thread was readied and the caller should
+ * reschedule.
+ */
+static inline bool wake_n_waiters_locked(struct k_mem_slab *slab)
+{
+	return IS_ENABLED(CONFIG_MULTITHREADING) &&
+	       (z_unpend_all(&slab->wait_n_q) != 0);
+}
+
 void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	__ASSERT(block_is_valid(slab, mem), "Invalid memory pointer provided");
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cpu_cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		return;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 
-	__ASSERT(((char *)mem >= slab->buffer) &&
-		 ((((char *)mem - slab->buffer) % slab->info.block_size) == 0) &&
-		 ((char *)mem <= (slab->buffer + (slab->info.block_size *
-						  (slab->info.num_blocks - 1)))),
-		 "Invalid memory pointer provided");
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
 	if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
@@ -273,13 +447,148 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 			return;
 		}
 	}
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	cpu_cache_flush_locked(slab);
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 	*(char **) mem = slab->free_list;
 	slab->free_list = (char *) mem;
 	slab->info.num_used--;
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
+	if (wake_n_waiters_locked(slab)) {
+		z_reschedule(&slab->lock, key);
+		return;
+	}
+
+	k_spin_unlock(&slab->lock, key);
+}
+
+/* Free a block, handing it to the first thread waiting in
+ * k_mem_slab_alloc() if any.
+ *
+ * Invoked with slab lock held.
+ *
+ * @return true if a waiting thread was readied and the caller should
+ * reschedule.
+ */
+static bool free_block_locked(struct k_mem_slab *slab, void *mem)
+{
+	if ((slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
+		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+		if (pending_thread != NULL) {
+			z_thread_return_value_set_with_data(pending_thread, 0, mem);
+			z_ready_thread(pending_thread);
+			return true;
+		}
+	}
+	*(char **) mem = slab->free_list;
+	slab->free_list = (char *) mem;
+	slab->info.num_used--;
+
+	return wake_n_waiters_locked(slab);
+}
+
+/* Number of blocks the current CPU can allocate without waiting.
+ *
+ * Invoked with slab lock held.
+ */
+static uint32_t num_available_locked(struct k_mem_slab *slab)
+{
+	uint32_t num_free = slab->info.num_blocks - slab->info.num_used;
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	num_free += slab->info.cpu_stats[_current_cpu->id].num_cached;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	return num_free;
+}
+
+/* Take count available blocks into mem.
+ *
+ * Invoked with slab lock held, with at least count blocks available.
+ */
+static void take_blocks_locked(struct k_mem_slab *slab, void **mem,
+			       uint32_t count)
+{
+	uint32_t n = 0U;
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	uint8_t cpu = _current_cpu->id;
+
+	for (; (n < count) && (slab->cpu_free_list[cpu] != NULL); n++) {
+		mem[n] = slab->cpu_free_list[cpu];
+		slab->cpu_free_list[cpu] = *(char **)(slab->cpu_free_list[cpu]);
+		slab->info.cpu_stats[cpu].num_cached--;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	for (; n < count; n++) {
+		mem[n] = slab->free_list;
+		slab->free_list = *(char **)(slab->free_list);
+		slab->info.num_used++;
+	}
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	trace_max_used(slab);
+#elif defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION)
+	slab->info.max_used = MAX(slab->info.num_used, slab->info.max_used);
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+}
+
+int k_mem_slab_alloc_n(struct k_mem_slab *slab, void **mem, uint32_t count,
+		       k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool may_wait = IS_ENABLED(CONFIG_MULTITHREADING) &&
+			!K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+
+	if (count > slab->info.num_blocks) {
+		k_spin_unlock(&slab->lock, key);
+		return -EINVAL;
+	}
+
+	/* Never hold blocks while waiting for others, threads waiting
+	 * for batches could otherwise deadlock each other: wait until
+	 * all the blocks are available, woken each time blocks are
+	 * freed, then take them at once.
+	 */
+	while (num_available_locked(slab) < count) {
+		if (!may_wait || sys_timepoint_expired(end)) {
+			k_spin_unlock(&slab->lock, key);
+			return may_wait ? -EAGAIN : -ENOMEM;
+		}
+
+		(void)z_pend_curr(&slab->lock, key, &slab->wait_n_q,
+				  sys_timepoint_timeout(end));
+		key = k_spin_lock(&slab->lock);
+	}
+
+	take_blocks_locked(slab, mem, count);
+
 	k_spin_unlock(&slab->lock, key);
+
+	return 0;
+}
+
+void k_mem_slab_free_n(struct k_mem_slab *slab, void **mem, uint32_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool resched = false;
+
+	for (uint32_t i = 0U; i < count; i++) {
+		__ASSERT(block_is_valid(slab, mem[i]), "Invalid memory pointer provided");
+
+		resched = free_block_locked(slab, mem[i]) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
 }
 
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
@@ -290,8 +599,9 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	stats->allocated_bytes = k_mem_slab_num_used_get(slab) *
+				 slab->info.block_size;
+	stats->free_bytes = k_mem_slab_num_free_get(slab) *
 			    slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
@@ -314,7 +624,7 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 
 	k_spin_unlock(&slab->lock, key);
 
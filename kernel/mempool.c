@@ -5,9 +5,16 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
 #include <string.h>
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/util.h>
+#include <kernel_internal.h>
+
+#if defined(CONFIG_HEAP_MEM_POOL_CPU_CACHE) && (K_HEAP_MEM_POOL_SIZE > 0)
+#define HEAP_CPU_CACHE
+static bool cpu_cache_free(struct k_heap **heap_ref);
+#endif
 
 static void *z_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t size)
 {
@@ -50,6 +57,13 @@ void k_free(void *ptr)
 
 		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_free, *heap_ref, heap_ref);
 
+#ifdef HEAP_CPU_CACHE
+		if (cpu_cache_free(heap_ref)) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_free, *heap_ref, heap_ref);
+			return;
+		}
+#endif
+
 		k_heap_free(*heap_ref, ptr);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_free, *heap_ref, heap_ref);
@@ -61,6 +75,263 @@ void k_free(void *ptr)
 K_HEAP_DEFINE(_system_heap, K_HEAP_MEM_POOL_SIZE);
 #define _SYSTEM_HEAP (&_system_heap)
 
+#ifdef HEAP_CPU_CACHE
+#define CACHE_MIN_SHIFT 4
+#define CACHE_MAX_SIZE  CONFIG_HEAP_MEM_POOL_CPU_CACHE_MAX_SIZE
+#define CACHE_CLASSES   (LOG2(CACHE_MAX_SIZE) - CACHE_MIN_SHIFT + 1)
+#define CACHE_DEPTH     CONFIG_HEAP_MEM_POOL_CPU_CACHE_DEPTH
+#define CACHE_BATCH     (CACHE_DEPTH / 2)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CACHE_MAX_SIZE),
+	     "cached block size must be a power of two");
+
+/* Blocks are cached as returned by the heap: the first word (the
+ * heap reference slot of k_malloc() blocks) links blocks of a class
+ * together, the second one holds the usable size of the block.
+ *
+ * A CPU only allocates from and frees to its own cache.  The lock
+ * is for the decay timer and the statistics, which walk all caches.
+ */
+struct cached_block {
+	struct cached_block *next;
+	size_t bytes;
+};
+
+struct heap_cpu_cache {
+	struct k_spinlock lock;
+	struct cached_block *blocks[CACHE_CLASSES];
+	uint8_t count[CACHE_CLASSES];
+	/* Lowest count since the last decay */
+	uint8_t low[CACHE_CLASSES];
+	size_t bytes;
+};
+
+static struct heap_cpu_cache cpu_caches[CONFIG_MP_MAX_NUM_CPUS];
+
+static inline size_t class_bytes(int cls)
+{
+	return BIT(cls + CACHE_MIN_SHIFT);
+}
+
+static struct heap_cpu_cache *cpu_cache_lock(unsigned int *irq,
+					     k_spinlock_key_t *key)
+{
+	struct heap_cpu_cache *cache;
+
+	*irq = arch_irq_lock();
+	cache = &cpu_caches[_current_cpu->id];
+	*key = k_spin_lock(&cache->lock);
+
+	return cache;
+}
+
+static void cpu_cache_unlock(struct heap_cpu_cache *cache, unsigned int irq,
+			     k_spinlock_key_t key)
+{
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+}
+
+static size_t cache_pop(struct heap_cpu_cache *cache, int cls,
+			void **blocks, size_t count)
+{
+	size_t n;
+
+	for (n = 0; (n < count) && (cache->blocks[cls] != NULL); n++) {
+		struct cached_block *b = cache->blocks[cls];
+
+		cache->blocks[cls] = b->next;
+		cache->bytes -= b->bytes;
+		blocks[n] = b;
+	}
+
+	cache->count[cls] -= n;
+	cache->low[cls] = MIN(cache->low[cls], cache->count[cls]);
+
+	return n;
+}
+
+static void cache_push(struct heap_cpu_cache *cache, int cls, void *block,
+		       size_t bytes)
+{
+	struct cached_block *b = block;
+
+	b->next = cache->blocks[cls];
+	b->bytes = bytes;
+	cache->blocks[cls] = b;
+	cache->bytes += bytes;
+	cache->count[cls]++;
+}
+
+/* Give cached blocks back to the heap: all of them, or the ones no
+ * allocation needed since the last call.
+ */
+static void cpu_caches_trim(bool all)
+{
+	void *blocks[CACHE_DEPTH];
+
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct heap_cpu_cache *cache = &cpu_caches[cpu];
+
+		for (int cls = 0; cls < CACHE_CLASSES; cls++) {
+			k_spinlock_key_t key = k_spin_lock(&cache->lock);
+			size_t n = cache_pop(cache, cls, blocks,
+					     all ? CACHE_DEPTH : cache->low[cls]);
+
+			cache->low[cls] = cache->count[cls];
+			k_spin_unlock(&cache->lock, key);
+
+			if (n > 0) {
+				k_heap_free_n(_SYSTEM_HEAP, blocks, n);
+			}
+		}
+	}
+}
+
+static void *cpu_cache_alloc(size_t bytes)
+{
+	int cls = MAX(LOG2CEIL(bytes), CACHE_MIN_SHIFT) - CACHE_MIN_SHIFT;
+	struct heap_cpu_cache *cache;
+	void *blocks[CACHE_BATCH];
+	k_spinlock_key_t key;
+	unsigned int irq;
+	size_t n;
+
+	cache = cpu_cache_lock(&irq, &key);
+	n = cache_pop(cache, cls, blocks, 1);
+	cpu_cache_unlock(cache, irq, key);
+
+	if (n != 0) {
+		return blocks[0];
+	}
+
+	/* Cache miss: refill it with a batch of blocks, taking the heap
+	 * lock once, or settle for a single block.
+	 */
+	if (k_heap_alloc_n(_SYSTEM_HEAP, blocks, CACHE_BATCH,
+			   class_bytes(cls), K_NO_WAIT) != 0) {
+		return k_heap_alloc(_SYSTEM_HEAP, class_bytes(cls), K_NO_WAIT);
+	}
+
+	cache = cpu_cache_lock(&irq, &key);
+	for (n = 1; (n < CACHE_BATCH) && (cache->count[cls] < CACHE_DEPTH); n++) {
+		cache_push(cache, cls, blocks[n],
+			   sys_heap_usable_size(&_system_heap.heap, blocks[n]));
+	}
+	cpu_cache_unlock(cache, irq, key);
+
+	if (n < CACHE_BATCH) {
+		k_heap_free_n(_SYSTEM_HEAP, &blocks[n], CACHE_BATCH - n);
+	}
+
+	return blocks[0];
+}
+
+static void *cpu_cache_aligned_alloc(size_t align, size_t size)
+{
+	struct k_heap **heap_ref;
+	size_t bytes;
+	void *mem;
+
+	if ((align <= sizeof(heap_ref)) &&
+	    !size_add_overflow(size, sizeof(heap_ref), &bytes) &&
+	    (bytes <= CACHE_MAX_SIZE)) {
+		mem = cpu_cache_alloc(bytes);
+		if (mem != NULL) {
+			heap_ref = mem;
+			*heap_ref = _SYSTEM_HEAP;
+			return ++heap_ref;
+		}
+	} else {
+		mem = z_heap_aligned_alloc(_SYSTEM_HEAP, align, size);
+		if (mem != NULL) {
+			return mem;
+		}
+	}
+
+	/* The memory may be sitting in caches */
+	cpu_caches_trim(true);
+
+	return z_heap_aligned_alloc(_SYSTEM_HEAP, align, size);
+}
+
+static bool cpu_cache_free(struct k_heap **heap_ref)
+{
+	struct heap_cpu_cache *cache;
+	void *blocks[CACHE_BATCH];
+	k_spinlock_key_t key;
+	unsigned int irq;
+	size_t bytes;
+	size_t n = 0;
+	int cls;
+
+	if (*heap_ref != _SYSTEM_HEAP) {
+		return false;
+	}
+
+	/* Allocated chunks are not modified by other heap operations:
+	 * their size can be read without the heap lock.
+	 */
+	bytes = sys_heap_usable_size(&_system_heap.heap, heap_ref);
+	if ((bytes < class_bytes(0)) || (bytes >= 2 * CACHE_MAX_SIZE)) {
+		return false;
+	}
+	cls = MIN(LOG2(bytes), LOG2(CACHE_MAX_SIZE)) - CACHE_MIN_SHIFT;
+
+	cache = cpu_cache_lock(&irq, &key);
+	if (cache->count[cls] == CACHE_DEPTH) {
+		n = cache_pop(cache, cls, blocks, CACHE_BATCH);
+	}
+	cache_push(cache, cls, heap_ref, bytes);
+	cpu_cache_unlock(cache, irq, key);
+
+	if (n > 0) {
+		k_heap_free_n(_SYSTEM_HEAP, blocks, n);
+	}
+
+	return true;
+}
+
+size_t z_heap_cpu_cache_bytes(struct sys_heap *heap)
+{
+	size_t bytes = 0;
+
+	if (heap != &_system_heap.heap) {
+		return 0;
+	}
+
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		K_SPINLOCK(&cpu_caches[cpu].lock) {
+			bytes += cpu_caches[cpu].bytes;
+		}
+	}
+
+	return bytes;
+}
+
+#if CONFIG_HEAP_MEM_POOL_CPU_CACHE_DECAY_MS > 0
+static void cpu_caches_decay(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	cpu_caches_trim(false);
+}
+
+static K_TIMER_DEFINE(cpu_caches_timer, cpu_caches_decay, NULL);
+
+static int cpu_caches_init(void)
+{
+	k_timer_start(&cpu_caches_timer,
+		      K_MSEC(CONFIG_HEAP_MEM_POOL_CPU_CACHE_DECAY_MS),
+		      K_MSEC(CONFIG_HEAP_MEM_POOL_CPU_CACHE_DECAY_MS));
+
+	return 0;
+}
+
+SYS_INIT(cpu_caches_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif
+#endif /* HEAP_CPU_CACHE */
+
 void *k_aligned_alloc(size_t align, size_t size)
 {
 	__ASSERT(align / sizeof(void *) >= 1
@@ -72,7 +343,11 @@ void *k_aligned_alloc(size_t align, size_t size)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP);
 
+#ifdef HEAP_CPU_CACHE
+	void *ret = cpu_cache_aligned_alloc(align, size);
+#else
 	void *ret = z_heap_aligned_alloc(_SYSTEM_HEAP, align, size);
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP, ret);
 
@@ -132,10 +407,14 @@ void *z_thread_aligned_alloc(size_t align, size_t size)
 		heap = _current->resource_pool;
 	}
 
-	if (heap != NULL) {
-		ret = z_heap_aligned_alloc(heap, align, size);
-	} else {
+	if (heap == NULL) {
 		ret = NULL;
+#ifdef HEAP_CPU_CACHE
+	} else if (heap == _SYSTEM_HEAP) {
+		ret = cpu_cache_aligned_alloc(align, size);
+#endif
+	} else {
+		ret = z_heap_aligned_alloc(heap, align, size);
 	}
 
 	return ret;
@@ -1380,6 +1380,30 @@ static inline void paging_stats_eviction_inc(struct k_thread *faulting_thread,
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 }
 
+static inline void paging_stats_read_ahead_inc(struct k_thread *thread,
+					       bool trigger)
+{
+#if defined(CONFIG_DEMAND_PAGING_STATS) && defined(CONFIG_DEMAND_PAGING_READ_AHEAD)
+	if (trigger) {
+		paging_stats.read_ahead.trigger++;
+	} else {
+		paging_stats.read_ahead.pages++;
+	}
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	if (trigger) {
+		thread->paging_stats.read_ahead.trigger++;
+	} else {
+		thread->paging_stats.read_ahead.pages++;
+	}
+#else
+	ARG_UNUSED(thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(trigger);
+#endif /* CONFIG_DEMAND_PAGING_STATS && CONFIG_DEMAND_PAGING_READ_AHEAD */
+}
+
 static inline struct z_page_frame *do_eviction_select(bool *dirty)
 {
 	struct z_page_frame *pf;
@@ -1414,7 +1438,13 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
-static bool do_page_fault(void *addr, bool pin)
+/* do_data_page_in() flags */
+#define PAGE_IN_PIN		BIT(0)	/* Pin the data page */
+#define PAGE_IN_HOLD		BIT(1)	/* Pin the data page if it gets loaded */
+#define PAGE_IN_READ_AHEAD	BIT(2)	/* Loading ahead of a page fault */
+
+static bool do_data_page_in(void *addr, unsigned int flags,
+			    struct k_thread *faulting_thread, bool *loaded)
 {
 	struct z_page_frame *pf;
 	int key, ret;
@@ -1422,7 +1452,9 @@ static bool do_page_fault(void *addr, bool pin)
 	enum arch_page_location status;
 	bool result;
 	bool dirty = false;
-	struct k_thread *faulting_thread = _current_cpu->current;
+	bool pin = (flags & PAGE_IN_PIN) != 0U;
+
+	*loaded = false;
 
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
 		 addr);
@@ -1493,7 +1525,11 @@ static bool do_page_fault(void *addr, bool pin)
 	__ASSERT(status == ARCH_PAGE_LOCATION_PAGED_OUT,
 		 "unexpected status value %d", status);
 
-	paging_stats_faults_inc(faulting_thread, key);
+	if ((flags & PAGE_IN_READ_AHEAD) != 0U) {
+		paging_stats_read_ahead_inc(faulting_thread, false);
+	} else {
+		paging_stats_faults_inc(faulting_thread, key);
+	}
 
 	pf = free_page_frame_list_get();
 	if (pf == NULL) {
@@ -1524,7 +1560,7 @@ static bool do_page_fault(void *addr, bool pin)
 	key = irq_lock();
 	pf->flags &= ~Z_PAGE_FRAME_BUSY;
 #endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
-	if (pin) {
+	if ((flags & (PAGE_IN_PIN | PAGE_IN_HOLD)) != 0U) {
 		pf->flags |= Z_PAGE_FRAME_PINNED;
 	}
 	pf->flags |= Z_PAGE_FRAME_MAPPED;
@@ -1533,6 +1569,7 @@ static bool do_page_fault(void *addr, bool pin)
 
 	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
 	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+	*loaded = true;
 out:
 	irq_unlock(key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -1542,6 +1579,182 @@ out:
 	return result;
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+static void do_mem_unpin(void *addr);
+
+/* Data page following the last one loaded for a page fault, or read ahead
+ * of one. A page fault on it is considered part of a sequential access.
+ */
+static uint8_t *read_ahead_next;
+
+/* Loads the paged out data pages among the ones following addr, up to the
+ * end of the read-ahead window or the first unmapped one, on behalf of
+ * thread.
+ *
+ * A data page just read ahead is clean and not accessed yet, making it the
+ * best candidate for eviction, so the data pages loaded are held until the
+ * end of the window, lest loading one evicts another.
+ */
+static void read_ahead(uint8_t *addr, struct k_thread *thread)
+{
+	uint8_t *page = addr;
+	uint64_t held = 0U;
+	unsigned int key;
+	bool loaded;
+	int i;
+
+	BUILD_ASSERT(CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES <= 64,
+		     "held data pages don't fit in a 64 bit mask");
+
+	/* Keep the pinned state of held data pages unchanged by others */
+	k_sched_lock();
+
+	for (i = 0; i < CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES; i++) {
+		if ((size_t)(Z_VIRT_RAM_END - page) <= CONFIG_MMU_PAGE_SIZE) {
+			break;
+		}
+		if (!do_data_page_in(page + CONFIG_MMU_PAGE_SIZE,
+				     PAGE_IN_READ_AHEAD | PAGE_IN_HOLD, thread,
+				     &loaded)) {
+			break;
+		}
+		page += CONFIG_MMU_PAGE_SIZE;
+		if (loaded) {
+			held |= BIT64(i);
+		}
+	}
+
+	while (i-- > 0) {
+		if ((held & BIT64(i)) != 0U) {
+			do_mem_unpin(addr + ((i + 1) * CONFIG_MMU_PAGE_SIZE));
+		}
+	}
+
+	k_sched_unlock();
+
+	key = irq_lock();
+	read_ahead_next = page + CONFIG_MMU_PAGE_SIZE;
+	irq_unlock(key);
+}
+
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD_ASYNC
+/* Doesn't reschedule, which isn't safe in page fault context */
+extern int z_work_submit_to_queue(struct k_work_q *queue,
+				  struct k_work *work);
+
+static struct k_work_q read_ahead_work_q;
+static K_KERNEL_PINNED_STACK_DEFINE(read_ahead_stack,
+				    CONFIG_DEMAND_PAGING_READ_AHEAD_STACK_SIZE);
+static uint8_t *read_ahead_addr;
+/* Thread which took the sequential page fault, accounted for the read-ahead */
+static struct k_thread *read_ahead_thread;
+
+static void read_ahead_handler(struct k_work *work)
+{
+	struct k_thread *thread;
+	unsigned int key;
+	uint8_t *addr;
+
+	ARG_UNUSED(work);
+
+	key = irq_lock();
+	addr = read_ahead_addr;
+	thread = read_ahead_thread;
+	irq_unlock(key);
+
+	read_ahead(addr, thread);
+}
+
+static K_WORK_DEFINE(read_ahead_work, read_ahead_handler);
+
+static int read_ahead_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "read_ahead",
+		.no_yield = true,
+	};
+
+	k_work_queue_start(&read_ahead_work_q, read_ahead_stack,
+			   K_KERNEL_STACK_SIZEOF(read_ahead_stack),
+			   CONFIG_DEMAND_PAGING_READ_AHEAD_THREAD_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(read_ahead_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD_ASYNC */
+
+/* Called once page has been loaded for a page fault, reads ahead of it if
+ * it is part of a sequential access.
+ */
+static void read_ahead_check(uint8_t *page)
+{
+	unsigned int key;
+	bool sequential;
+
+	key = irq_lock();
+	sequential = (page == read_ahead_next);
+	read_ahead_next = page + CONFIG_MMU_PAGE_SIZE;
+	if (sequential) {
+		paging_stats_read_ahead_inc(_current_cpu->current, true);
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD_ASYNC
+		read_ahead_addr = page;
+		read_ahead_thread = _current_cpu->current;
+		(void)z_work_submit_to_queue(&read_ahead_work_q,
+					     &read_ahead_work);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD_ASYNC */
+	}
+	irq_unlock(key);
+
+	if (sequential && !IS_ENABLED(CONFIG_DEMAND_PAGING_READ_AHEAD_ASYNC)) {
+		read_ahead(page, _current_cpu->current);
+	}
+}
+
+static bool do_page_fault(void *addr, bool pin)
+{
+	uint8_t *page = UINT_TO_POINTER(POINTER_TO_UINT(addr) &
+					~(CONFIG_MMU_PAGE_SIZE - 1));
+	unsigned int flags = pin ? PAGE_IN_PIN : 0U;
+	/* Page faults in ISRs are kept as short as possible */
+	bool sync = !k_is_in_isr() &&
+		    !IS_ENABLED(CONFIG_DEMAND_PAGING_READ_AHEAD_ASYNC);
+	bool result, loaded;
+
+	if (sync) {
+		/* Keep the faulting data page loaded until it gets accessed,
+		 * and its pinned state unchanged by other threads, while
+		 * reading ahead of it.
+		 */
+		k_sched_lock();
+		flags |= PAGE_IN_HOLD;
+	}
+
+	result = do_data_page_in(addr, flags, _current_cpu->current, &loaded);
+
+	if (loaded && !k_is_in_isr()) {
+		read_ahead_check(page);
+	}
+
+	if (sync) {
+		if (loaded && !pin) {
+			do_mem_unpin(page);
+		}
+		k_sched_unlock();
+	}
+
+	return result;
+}
+#else
+static bool do_page_fault(void *addr, bool pin)
+{
+	bool loaded;
+
+	return do_data_page_in(addr, pin ? PAGE_IN_PIN : 0U,
+			       _current_cpu->current, &loaded);
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static void do_page_in(void *addr)
 {
 	bool ret;
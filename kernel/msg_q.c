@@ -36,6 +36,135 @@ static inline void handle_poll_events(struct k_msgq *msgq, uint32_t state)
 }
 #endif /* CONFIG_POLL */
 
+/* Stands for the message buffer of the threads waiting in
+ * k_msgq_put_claim() or k_msgq_get_claim(), which get the address of
+ * the claimed slot in its place.
+ */
+static char claim_waiter;
+
+static inline uint32_t msgq_num_free(struct k_msgq *msgq)
+{
+	return msgq->max_msgs - msgq->used_msgs - msgq->put_held -
+	       msgq->get_held;
+}
+
+static inline void msgq_next(struct k_msgq *msgq, char **ptr)
+{
+	*ptr += msgq->msg_size;
+	if (*ptr == msgq->buffer_end) {
+		*ptr = msgq->buffer_start;
+	}
+}
+
+/* Queue a message in the next free slot. Messages queued while a slot is
+ * claimed for sending are held behind it until it is committed.
+ */
+static void msgq_store(struct k_msgq *msgq, const void *data)
+{
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+	(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
+	msgq_next(msgq, &msgq->write_ptr);
+	if (msgq->put_held != 0U) {
+		msgq->put_held++;
+	} else {
+		msgq->used_msgs++;
+#ifdef CONFIG_POLL
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+}
+
+/* Remove the first message, copying it to @a data unless NULL. The slot
+ * of a message removed while a slot is claimed for receiving is only freed
+ * along with the claimed one.
+ */
+static void msgq_load(struct k_msgq *msgq, void *data)
+{
+	if (data != NULL) {
+		(void)memcpy(data, msgq->read_ptr, msgq->msg_size);
+	}
+	msgq_next(msgq, &msgq->read_ptr);
+	msgq->used_msgs--;
+	if (msgq->get_held != 0U) {
+		msgq->get_held++;
+	}
+}
+
+static inline void msgq_wake(struct k_thread *thread, int value)
+{
+	arch_thread_return_value_set(thread, value);
+	z_ready_thread(thread);
+}
+
+/* Give the first message to a thread unpended from the readers */
+static void msgq_serve_reader(struct k_msgq *msgq, struct k_thread *thread)
+{
+	if (thread->base.swap_data != &claim_waiter) {
+		msgq_load(msgq, thread->base.swap_data);
+	} else if (msgq->get_held == 0U) {
+		thread->base.swap_data = msgq->read_ptr;
+		msgq_load(msgq, NULL);
+		msgq->get_held = 1U;
+	} else {
+		msgq_wake(thread, -EBUSY);
+		return;
+	}
+	msgq_wake(thread, 0);
+}
+
+/* Give the next free slot to a thread unpended from the writers */
+static void msgq_serve_writer(struct k_msgq *msgq, struct k_thread *thread)
+{
+	if (thread->base.swap_data != &claim_waiter) {
+		msgq_store(msgq, thread->base.swap_data);
+	} else if (msgq->put_held == 0U) {
+		thread->base.swap_data = msgq->write_ptr;
+		msgq_next(msgq, &msgq->write_ptr);
+		msgq->put_held = 1U;
+	} else {
+		msgq_wake(thread, -EBUSY);
+		return;
+	}
+	msgq_wake(thread, 0);
+}
+
+/* Hand the queued messages to the waiting readers and the free slots to
+ * the waiting writers, returning true if any thread was woken up.
+ */
+static bool msgq_serve_waiters(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	bool woken = false;
+	bool served;
+
+	do {
+		served = false;
+
+		while (msgq->used_msgs > 0U) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q.readers);
+			if (pending_thread == NULL) {
+				break;
+			}
+			msgq_serve_reader(msgq, pending_thread);
+			served = true;
+		}
+
+		while (msgq_num_free(msgq) > 0U) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q.writers);
+			if (pending_thread == NULL) {
+				break;
+			}
+			msgq_serve_writer(msgq, pending_thread);
+			served = true;
+		}
+
+		woken = woken || served;
+	} while (served);
+
+	return woken;
+}
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -46,8 +175,11 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->read_ptr = buffer;
 	msgq->write_ptr = buffer;
 	msgq->used_msgs = 0;
+	msgq->put_held = 0;
+	msgq->get_held = 0;
 	msgq->flags = 0;
-	z_waitq_init(&msgq->wait_q);
+	z_waitq_init(&msgq->wait_q.readers);
+	z_waitq_init(&msgq->wait_q.writers);
 	msgq->lock = (struct k_spinlock) {};
 #ifdef CONFIG_POLL
 	sys_dlist_init(&msgq->poll_events);
@@ -104,7 +236,8 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, cleanup, msgq);
 
-	CHECKIF(z_waitq_head(&msgq->wait_q) != NULL) {
+	CHECKIF((z_waitq_head(&msgq->wait_q.readers) != NULL) ||
+		(z_waitq_head(&msgq->wait_q.writers) != NULL)) {
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, cleanup, msgq, -EBUSY);
 
 		return -EBUSY;
@@ -133,33 +266,36 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
 
-	if (msgq->used_msgs < msgq->max_msgs) {
+	if (msgq_num_free(msgq) > 0U) {
 		/* message queue isn't full */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (pending_thread != NULL) {
+		pending_thread = NULL;
+		if (msgq->put_held == 0U) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q.readers);
+		}
+		if (pending_thread != NULL &&
+		    pending_thread->base.swap_data != &claim_waiter) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, 0);
 
 			/* give message to waiting thread */
 			(void)memcpy(pending_thread->base.swap_data, data,
 			       msgq->msg_size);
 			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
+			msgq_wake(pending_thread, 0);
+			z_reschedule(&msgq->lock, key);
+			return 0;
+		} else if (pending_thread != NULL) {
+			/* hand the queued message to the claiming thread */
+			msgq_store(msgq, data);
+			msgq_serve_reader(msgq, pending_thread);
+			(void)msgq_serve_waiters(msgq);
+
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, 0);
+
 			z_reschedule(&msgq->lock, key);
 			return 0;
 		} else {
 			/* put message in queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
-#ifdef CONFIG_POLL
-			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
-#endif /* CONFIG_POLL */
+			msgq_store(msgq, data);
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -171,7 +307,8 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 		/* wait for put message success, failure, or timeout */
 		_current->base.swap_data = (void *) data;
 
-		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q.writers,
+				     timeout);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
 		return result;
 	}
@@ -218,7 +355,6 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
 	k_spinlock_key_t key;
-	struct k_thread *pending_thread;
 	int result;
 
 	key = k_spin_lock(&msgq->lock);
@@ -227,36 +363,13 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 	if (msgq->used_msgs > 0U) {
 		/* take first available message from queue */
-		(void)memcpy(data, msgq->read_ptr, msgq->msg_size);
-		msgq->read_ptr += msgq->msg_size;
-		if (msgq->read_ptr == msgq->buffer_end) {
-			msgq->read_ptr = msgq->buffer_start;
-		}
-		msgq->used_msgs--;
-
-		/* handle first thread waiting to write (if any) */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (pending_thread != NULL) {
-			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
-
-			/* add thread's message to queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
-
-			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
-			z_reschedule(&msgq->lock, key);
+		msgq_load(msgq, data);
 
+		/* handle threads waiting to write (if any) */
+		if (msgq_serve_waiters(msgq)) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, 0);
 
+			z_reschedule(&msgq->lock, key);
 			return 0;
 		}
 		result = 0;
@@ -269,7 +382,8 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 		/* wait for get message success or timeout */
 		_current->base.swap_data = data;
 
-		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q.readers,
+				     timeout);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
 		return result;
 	}
@@ -293,6 +407,267 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <syscalls/k_msgq_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_k_msgq_put_n(struct k_msgq *msgq, const void *data,
+			uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	const char *msg = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	bool woken = false;
+	uint32_t num;
+	int result;
+
+	if (num_msgs == 0U) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	for (num = 0U; num < num_msgs && msgq_num_free(msgq) > 0U; num++) {
+		pending_thread = NULL;
+		if (msgq->put_held == 0U) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q.readers);
+		}
+		if (pending_thread != NULL &&
+		    pending_thread->base.swap_data != &claim_waiter) {
+			/* give message to waiting thread */
+			(void)memcpy(pending_thread->base.swap_data, msg,
+				     msgq->msg_size);
+			msgq_wake(pending_thread, 0);
+			woken = true;
+		} else {
+			msgq_store(msgq, msg);
+			if (pending_thread != NULL) {
+				msgq_serve_reader(msgq, pending_thread);
+				(void)msgq_serve_waiters(msgq);
+				woken = true;
+			}
+		}
+		msg += msgq->msg_size;
+	}
+
+	if (num > 0U) {
+		result = num;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* wait for the first message to be put, as k_msgq_put() */
+		_current->base.swap_data = (void *)data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q.writers,
+				     timeout);
+		return (result == 0) ? 1 : result;
+	}
+
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_n(struct k_msgq *msgq, const void *data,
+				      uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_n(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_put_n_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_get_n(struct k_msgq *msgq, void *data, uint32_t num_msgs,
+			k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	char *msg = data;
+	k_spinlock_key_t key;
+	bool woken = false;
+	uint32_t num = 0U;
+	int result;
+
+	if (num_msgs == 0U) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	while (num < num_msgs && msgq->used_msgs > 0U) {
+		do {
+			msgq_load(msgq, msg);
+			msg += msgq->msg_size;
+			num++;
+		} while (num < num_msgs && msgq->used_msgs > 0U);
+
+		/* let the threads waiting to write refill the queue */
+		if (msgq_serve_waiters(msgq)) {
+			woken = true;
+		}
+	}
+
+	if (num > 0U) {
+		result = num;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* wait for a single message, as k_msgq_get() */
+		_current->base.swap_data = data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q.readers,
+				     timeout);
+		return (result == 0) ? 1 : result;
+	}
+
+	if (woken) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_n(struct k_msgq *msgq, void *data,
+				      uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_n(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_get_n_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int k_msgq_put_claim(struct k_msgq *msgq, void **slot, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (msgq->put_held != 0U) {
+		result = -EBUSY;
+	} else if (msgq_num_free(msgq) > 0U) {
+		/* reserve the next free slot */
+		*slot = msgq->write_ptr;
+		msgq_next(msgq, &msgq->write_ptr);
+		msgq->put_held = 1U;
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* wait for a slot to be handed over */
+		_current->base.swap_data = &claim_waiter;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q.writers,
+				     timeout);
+		if (result == 0) {
+			*slot = _current->base.swap_data;
+		}
+		return result;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_put_commit(struct k_msgq *msgq)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (msgq->put_held == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	/* the claimed slot and the messages queued behind it can be read */
+	msgq->used_msgs += msgq->put_held;
+	msgq->put_held = 0U;
+#ifdef CONFIG_POLL
+	handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+
+	if (msgq_serve_waiters(msgq)) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+int k_msgq_get_claim(struct k_msgq *msgq, void **slot, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (msgq->get_held != 0U) {
+		result = -EBUSY;
+	} else if (msgq->used_msgs > 0U) {
+		/* lend the slot of the first message */
+		*slot = msgq->read_ptr;
+		msgq_load(msgq, NULL);
+		msgq->get_held = 1U;
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* wait for a message to be handed over */
+		_current->base.swap_data = &claim_waiter;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q.readers,
+				     timeout);
+		if (result == 0) {
+			*slot = _current->base.swap_data;
+		}
+		return result;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_get_release(struct k_msgq *msgq)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (msgq->get_held == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	/* free the claimed slot and the slots of the messages read after it */
+	msgq->get_held = 0U;
+
+	if (msgq_serve_waiters(msgq)) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -377,19 +752,30 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 {
 	k_spinlock_key_t key;
 	struct k_thread *pending_thread;
+	size_t offset;
 
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, purge, msgq);
 
 	/* wake up any threads that are waiting to write */
-	while ((pending_thread = z_unpend_first_thread(&msgq->wait_q)) != NULL) {
-		arch_thread_return_value_set(pending_thread, -ENOMSG);
-		z_ready_thread(pending_thread);
+	while ((pending_thread = z_unpend_first_thread(&msgq->wait_q.writers)) != NULL) {
+		msgq_wake(pending_thread, -ENOMSG);
 	}
 
+	/* the purged slots stay held along with a slot claimed for reading */
+	if (msgq->get_held != 0U) {
+		msgq->get_held += msgq->used_msgs;
+	}
+
+	/* skip the messages up to a slot claimed for writing, if any */
+	offset = (msgq->read_ptr - msgq->buffer_start) +
+		 (msgq->used_msgs * msgq->msg_size);
+	if (offset >= (size_t)(msgq->buffer_end - msgq->buffer_start)) {
+		offset -= msgq->buffer_end - msgq->buffer_start;
+	}
 	msgq->used_msgs = 0;
-	msgq->read_ptr = msgq->write_ptr;
+	msgq->read_ptr = msgq->buffer_start + offset;
 
 	z_reschedule(&msgq->lock, key);
 }
@@ -35,7 +35,7 @@ int32_t z_impl_k_sleep(k_timeout_t timeout)
 		return (int32_t) K_TICKS_FOREVER;
 	}
 
-	ticks = timeout.ticks;
+	ticks = Z_TICK_NO_SLACK(timeout.ticks);
 	if (Z_TICK_ABS(ticks) <= 0) {
 		expected_wakeup_ticks = ticks + sys_clock_tick_get_32();
 	} else {
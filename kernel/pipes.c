@@ -31,6 +31,11 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 			     void *data, size_t bytes_to_read,
 			     size_t *bytes_read, size_t min_xfer,
 			     k_timeout_t timeout);
+#ifdef CONFIG_PIPE_SPSC
+static inline bool pipe_is_spsc(struct k_pipe *pipe);
+static size_t pipe_spsc_read(struct k_pipe *pipe, unsigned char *data,
+			     size_t bytes_to_read);
+#endif /* CONFIG_PIPE_SPSC */
 #ifdef CONFIG_OBJ_CORE_PIPE
 static struct k_obj_type obj_type_pipe;
 #endif /* CONFIG_OBJ_CORE_PIPE */
@@ -60,6 +65,20 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 #endif /* CONFIG_OBJ_CORE_PIPE */
 }
 
+#ifdef CONFIG_PIPE_SPSC
+void k_pipe_spsc_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
+{
+	__ASSERT((buffer != NULL) && (size != 0U),
+		 "SPSC pipes need a ring buffer");
+
+	k_pipe_init(pipe, buffer, size);
+	pipe->flags = K_PIPE_FLAG_SPSC;
+	atomic_clear(&pipe->spsc_head);
+	atomic_clear(&pipe->spsc_tail);
+	atomic_clear(&pipe->spsc_waiters);
+}
+#endif /* CONFIG_PIPE_SPSC */
+
 int z_impl_k_pipe_alloc_init(struct k_pipe *pipe, size_t size)
 {
 	void *buffer;
@@ -111,6 +130,15 @@ void z_impl_k_pipe_flush(struct k_pipe *pipe)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, flush, pipe);
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		(void)pipe_spsc_read(pipe, NULL, pipe->size);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, flush, pipe);
+		return;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
 	(void) pipe_get_internal(key, pipe, NULL, (size_t) -1, &bytes_read, 0U,
@@ -135,6 +163,15 @@ void z_impl_k_pipe_buffer_flush(struct k_pipe *pipe)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, buffer_flush, pipe);
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		(void)pipe_spsc_read(pipe, NULL, pipe->size);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, buffer_flush, pipe);
+		return;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
 	if (pipe->buffer != NULL) {
@@ -377,6 +414,234 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 	return num_bytes_written;
 }
 
+#ifdef CONFIG_PIPE_SPSC
+/*
+ * Single reader, single writer pipes keep their read and write indexes
+ * in [0, 2 * size), so that a full buffer can be told from an empty one.
+ * Each index is only updated by its own side, after (writer) or before
+ * (reader) the data is copied, so the pipe lock is only needed to wait
+ * for the other side: a side that has to wait flags itself in
+ * spsc_waiters before checking the indexes one last time, and each side
+ * checks these flags after updating its index.
+ */
+#define SPSC_READER BIT(0)
+#define SPSC_WRITER BIT(1)
+
+static inline bool pipe_is_spsc(struct k_pipe *pipe)
+{
+	return (pipe->flags & K_PIPE_FLAG_SPSC) != 0U;
+}
+
+static inline size_t pipe_spsc_used(struct k_pipe *pipe, size_t head,
+				    size_t tail)
+{
+	return (head >= tail) ? (head - tail) : (head + 2 * pipe->size - tail);
+}
+
+static inline size_t pipe_spsc_advance(struct k_pipe *pipe, size_t index,
+				       size_t bytes)
+{
+	index += bytes;
+
+	return (index >= 2 * pipe->size) ? (index - 2 * pipe->size) : index;
+}
+
+static inline size_t pipe_spsc_offset(struct k_pipe *pipe, size_t index)
+{
+	return (index >= pipe->size) ? (index - pipe->size) : index;
+}
+
+static size_t pipe_spsc_read_avail(struct k_pipe *pipe)
+{
+	return pipe_spsc_used(pipe, (size_t)atomic_get(&pipe->spsc_head),
+			      (size_t)atomic_get(&pipe->spsc_tail));
+}
+
+static size_t pipe_spsc_write_avail(struct k_pipe *pipe)
+{
+	return pipe->size - pipe_spsc_read_avail(pipe);
+}
+
+/* Wake the other side up if it is waiting for the index just updated */
+static void pipe_spsc_wake(struct k_pipe *pipe, atomic_val_t side,
+			   _wait_q_t *wait_q)
+{
+	struct k_thread *thread;
+	k_spinlock_key_t key;
+
+	if ((atomic_get(&pipe->spsc_waiters) & side) == 0) {
+		return;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	if ((atomic_and(&pipe->spsc_waiters, ~side) & side) != 0) {
+		thread = z_unpend_first_thread(wait_q);
+		if (thread != NULL) {
+			arch_thread_return_value_set(thread, 0);
+			z_ready_thread(thread);
+			z_reschedule(&pipe->lock, key);
+			return;
+		}
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+}
+
+/* Wait for the other side, returning false on timeout */
+static bool pipe_spsc_wait(struct k_pipe *pipe, atomic_val_t side,
+			   _wait_q_t *wait_q, k_timepoint_t end)
+{
+	k_spinlock_key_t key;
+	size_t avail;
+	int ret;
+
+	key = k_spin_lock(&pipe->lock);
+
+	(void)atomic_or(&pipe->spsc_waiters, side);
+
+	avail = (side == SPSC_READER) ? pipe_spsc_read_avail(pipe)
+				      : pipe_spsc_write_avail(pipe);
+	if (avail != 0U) {
+		(void)atomic_and(&pipe->spsc_waiters, ~side);
+		k_spin_unlock(&pipe->lock, key);
+		return true;
+	}
+
+	ret = z_pend_curr(&pipe->lock, key, wait_q, sys_timepoint_timeout(end));
+	if (ret != 0) {
+		key = k_spin_lock(&pipe->lock);
+		(void)atomic_and(&pipe->spsc_waiters, ~side);
+		k_spin_unlock(&pipe->lock, key);
+		return false;
+	}
+
+	return true;
+}
+
+static size_t pipe_spsc_write(struct k_pipe *pipe, const unsigned char *data,
+			      size_t bytes_to_write)
+{
+	size_t head = (size_t)atomic_get(&pipe->spsc_head);
+	size_t tail = (size_t)atomic_get(&pipe->spsc_tail);
+	size_t offset = pipe_spsc_offset(pipe, head);
+	size_t bytes;
+	size_t chunk;
+
+	bytes = MIN(bytes_to_write, pipe->size - pipe_spsc_used(pipe, head, tail));
+	if (bytes == 0U) {
+		return 0U;
+	}
+
+	chunk = MIN(bytes, pipe->size - offset);
+	(void)memcpy(&pipe->buffer[offset], data, chunk);
+	(void)memcpy(&pipe->buffer[0], data + chunk, bytes - chunk);
+
+	atomic_set(&pipe->spsc_head,
+		   (atomic_val_t)pipe_spsc_advance(pipe, head, bytes));
+
+	handle_poll_events(pipe);
+	pipe_spsc_wake(pipe, SPSC_READER, &pipe->wait_q.readers);
+
+	return bytes;
+}
+
+static size_t pipe_spsc_read(struct k_pipe *pipe, unsigned char *data,
+			     size_t bytes_to_read)
+{
+	size_t tail = (size_t)atomic_get(&pipe->spsc_tail);
+	size_t head = (size_t)atomic_get(&pipe->spsc_head);
+	size_t offset = pipe_spsc_offset(pipe, tail);
+	size_t bytes;
+	size_t chunk;
+
+	bytes = MIN(bytes_to_read, pipe_spsc_used(pipe, head, tail));
+	if (bytes == 0U) {
+		return 0U;
+	}
+
+	if (data != NULL) {
+		chunk = MIN(bytes, pipe->size - offset);
+		(void)memcpy(data, &pipe->buffer[offset], chunk);
+		(void)memcpy(data + chunk, &pipe->buffer[0], bytes - chunk);
+	}
+
+	atomic_set(&pipe->spsc_tail,
+		   (atomic_val_t)pipe_spsc_advance(pipe, tail, bytes));
+
+	pipe_spsc_wake(pipe, SPSC_WRITER, &pipe->wait_q.writers);
+
+	return bytes;
+}
+
+static int pipe_spsc_put(struct k_pipe *pipe, const unsigned char *data,
+			 size_t bytes_to_write, size_t *bytes_written,
+			 size_t min_xfer, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	size_t written = 0U;
+
+	if ((pipe_spsc_write_avail(pipe) < min_xfer) &&
+	    K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		*bytes_written = 0U;
+		return -EIO;
+	}
+
+	for (;;) {
+		written += pipe_spsc_write(pipe, data + written,
+					   bytes_to_write - written);
+
+		if ((written == bytes_to_write) ||
+		    K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+		    ((written >= min_xfer) && (min_xfer > 0U))) {
+			*bytes_written = written;
+			return 0;
+		}
+
+		if (!pipe_spsc_wait(pipe, SPSC_WRITER, &pipe->wait_q.writers,
+				    end)) {
+			*bytes_written = written;
+			return pipe_return_code(min_xfer, bytes_to_write - written,
+						bytes_to_write);
+		}
+	}
+}
+
+static int pipe_spsc_get(struct k_pipe *pipe, unsigned char *data,
+			 size_t bytes_to_read, size_t *bytes_read,
+			 size_t min_xfer, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	size_t num_read = 0U;
+
+	if ((pipe_spsc_read_avail(pipe) < min_xfer) &&
+	    K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		*bytes_read = 0U;
+		return -EIO;
+	}
+
+	for (;;) {
+		num_read += pipe_spsc_read(pipe,
+					   (data != NULL) ? data + num_read : NULL,
+					   bytes_to_read - num_read);
+
+		if ((num_read == bytes_to_read) ||
+		    K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+		    ((num_read >= min_xfer) && (min_xfer > 0U))) {
+			*bytes_read = num_read;
+			return 0;
+		}
+
+		if (!pipe_spsc_wait(pipe, SPSC_READER, &pipe->wait_q.readers,
+				    end)) {
+			*bytes_read = num_read;
+			return pipe_return_code(min_xfer, bytes_to_read - num_read,
+						bytes_to_read);
+		}
+	}
+}
+#endif /* CONFIG_PIPE_SPSC */
+
 int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 		      size_t bytes_to_write, size_t *bytes_written,
 		      size_t min_xfer, k_timeout_t timeout)
@@ -401,6 +666,17 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		int ret = pipe_spsc_put(pipe, data, bytes_to_write,
+					bytes_written, min_xfer, timeout);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout, ret);
+
+		return ret;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	sys_dlist_init(&src_list);
 	sys_dlist_init(&dest_list);
 
@@ -711,6 +987,17 @@ int z_impl_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		int ret = pipe_spsc_get(pipe, data, bytes_to_read, bytes_read,
+					min_xfer, timeout);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, get, pipe, timeout, ret);
+
+		return ret;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
 	int ret = pipe_get_internal(key, pipe, data, bytes_to_read, bytes_read,
@@ -747,6 +1034,13 @@ size_t z_impl_k_pipe_read_avail(struct k_pipe *pipe)
 		goto out;
 	}
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		res = pipe_spsc_read_avail(pipe);
+		goto out;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	key = k_spin_lock(&pipe->lock);
 
 	if (pipe->read_index == pipe->write_index) {
@@ -784,6 +1078,13 @@ size_t z_impl_k_pipe_write_avail(struct k_pipe *pipe)
 		goto out;
 	}
 
+#ifdef CONFIG_PIPE_SPSC
+	if (pipe_is_spsc(pipe)) {
+		res = pipe_spsc_write_avail(pipe);
+		goto out;
+	}
+#endif /* CONFIG_PIPE_SPSC */
+
 	key = k_spin_lock(&pipe->lock);
 
 	if (pipe->write_index == pipe->read_index) {
@@ -35,10 +35,13 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+#ifdef CONFIG_POLL_SET
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
+#endif
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -70,6 +73,13 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 		}
 		break;
 	case K_POLL_TYPE_DATA_AVAILABLE:
+#ifdef CONFIG_QUEUE_LOCKLESS
+		/* Lockless queue producers only signal poll events once this
+		 * is set, so it must be set before checking the queue.
+		 */
+		(void)atomic_or(&event->queue->lockless,
+				Z_QUEUE_LOCKLESS_POLLED);
+#endif /* CONFIG_QUEUE_LOCKLESS */
 		if (!k_queue_is_empty(event->queue)) {
 			*state = K_POLL_STATE_FIFO_DATA_AVAILABLE;
 			return true;
@@ -109,22 +119,32 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Only threads in k_poll() are notified in priority order, poll sets and
+ * triggered work items have no priority and come after them.
+ */
+static inline bool is_thread_poller(struct z_poller *poller)
+{
+	return poller->mode == MODE_POLL;
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
 	struct k_poll_event *pending;
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	if ((pending == NULL) || !is_thread_poller(poller) ||
+		(is_thread_poller(pending->poller) &&
+		 (z_sched_prio_cmp(poller_thread(pending->poller),
+							   poller_thread(poller)) > 0))) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (!is_thread_poller(pending->poller) ||
+		    (z_sched_prio_cmp(poller_thread(poller),
+					poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -444,6 +464,12 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	int retcode = 0;
 
 	if (poller != NULL) {
+#ifdef CONFIG_POLL_SET
+		if (poller->mode == MODE_SET) {
+			/* Poll set events stay registered and keep their poller */
+			return signal_poll_set(event, state);
+		}
+#endif /* CONFIG_POLL_SET */
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
@@ -477,6 +503,26 @@ void z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state)
 	k_spin_unlock(&lock, key);
 }
 
+#ifdef CONFIG_QUEUE_LOCKLESS
+void z_handle_queue_poll_events(struct k_queue *queue, uint32_t state)
+{
+	struct k_poll_event *poll_event;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	poll_event = (struct k_poll_event *)sys_dlist_get(&queue->poll_events);
+	if (poll_event != NULL) {
+		(void) signal_poll_event(poll_event, state);
+	}
+
+	/* Pollers set the flag again before they check the queue */
+	if (sys_dlist_is_empty(&queue->poll_events)) {
+		(void)atomic_and(&queue->lockless, ~Z_QUEUE_LOCKLESS_POLLED);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 void z_impl_k_poll_signal_init(struct k_poll_signal *sig)
 {
 	sys_dlist_init(&sig->poll_events);
@@ -813,3 +859,342 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+#ifdef CONFIG_POLL_SET
+/* must be called with interrupts locked */
+static bool wake_poll_set_waiter(struct k_poll_set *set)
+{
+	struct k_thread *thread = z_unpend_first_thread(&set->wait_q);
+
+	if (thread == NULL) {
+		return false;
+	}
+
+	arch_thread_return_value_set(thread, 0);
+	z_ready_thread(thread);
+
+	return true;
+}
+
+/* must be called with interrupts locked */
+static void set_entry_ready(struct k_poll_set *set,
+			    struct k_poll_set_entry *entry, uint32_t state)
+{
+	entry->event.state |= state;
+
+	if (!sys_dnode_is_linked(&entry->ready_node)) {
+		sys_dlist_append(&set->ready, &entry->ready_node);
+	}
+}
+
+/* must be called with interrupts locked */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set =
+		CONTAINER_OF(event->poller, struct k_poll_set, poller);
+
+	/* The object let go of the event when signaling it, register it
+	 * again for the next state change.
+	 */
+	register_event(event, event->poller);
+
+	set_entry_ready(set,
+			CONTAINER_OF(event, struct k_poll_set_entry, event),
+			state);
+	(void)wake_poll_set_waiter(set);
+
+	return 0;
+}
+
+/* must be called with interrupts locked */
+static struct k_poll_set_entry *find_set_entry(struct k_poll_set *set,
+					       void *obj)
+{
+	for (int i = 0; i < set->max_entries; i++) {
+		struct k_poll_set_entry *entry = &set->entries[i];
+
+		if (entry->event.type != K_POLL_TYPE_IGNORE &&
+		    entry->event.obj == obj) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+void k_poll_set_init(struct k_poll_set *set, struct k_poll_set_entry *entries,
+		     int max_entries)
+{
+	__ASSERT(max_entries >= 0, "<0 entries\n");
+
+	z_waitq_init(&set->wait_q);
+	sys_dlist_init(&set->ready);
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	set->entries = entries;
+	set->max_entries = max_entries;
+	(void)memset(entries, 0, max_entries * sizeof(*entries));
+
+	k_object_init(set);
+}
+
+int z_impl_k_poll_set_add(struct k_poll_set *set, uint32_t type, void *obj,
+			  uint8_t tag, uint32_t flags)
+{
+	struct k_poll_set_entry *entry = NULL;
+	k_spinlock_key_t key;
+	uint32_t state;
+
+	if (type == K_POLL_TYPE_IGNORE || type >= BIT(_POLL_NUM_TYPES) ||
+	    obj == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (find_set_entry(set, obj) != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EEXIST;
+	}
+
+	for (int i = 0; entry == NULL && i < set->max_entries; i++) {
+		if (set->entries[i].event.type == K_POLL_TYPE_IGNORE) {
+			entry = &set->entries[i];
+		}
+	}
+
+	if (entry == NULL) {
+		k_spin_unlock(&lock, key);
+		return -ENOSPC;
+	}
+
+	/* Statically defined sets don't have their mode set yet */
+	set->poller.mode = MODE_SET;
+
+	entry->event = (struct k_poll_event)
+		K_POLL_EVENT_STATIC_INITIALIZER(type, K_POLL_MODE_NOTIFY_ONLY,
+						obj, tag);
+	entry->flags = flags;
+	register_event(&entry->event, &set->poller);
+
+	if (is_condition_met(&entry->event, &state)) {
+		set_entry_ready(set, entry, state);
+		if (wake_poll_set_waiter(set)) {
+			z_reschedule(&lock, key);
+			return 0;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int z_impl_k_poll_set_modify(struct k_poll_set *set, void *obj, uint8_t tag,
+			     uint32_t flags)
+{
+	struct k_poll_set_entry *entry;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	entry = find_set_entry(set, obj);
+	if (entry == NULL) {
+		k_spin_unlock(&lock, key);
+		return -ENOENT;
+	}
+
+	entry->event.tag = tag;
+	entry->flags = flags;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int z_impl_k_poll_set_remove(struct k_poll_set *set, void *obj)
+{
+	struct k_poll_set_entry *entry;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	entry = find_set_entry(set, obj);
+	if (entry == NULL) {
+		k_spin_unlock(&lock, key);
+		return -ENOENT;
+	}
+
+	clear_event_registration(&entry->event);
+	if (sys_dnode_is_linked(&entry->ready_node)) {
+		sys_dlist_remove(&entry->ready_node);
+	}
+	entry->event.type = K_POLL_TYPE_IGNORE;
+	entry->event.state = K_POLL_STATE_NOT_READY;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+/* must be called with interrupts locked */
+static int collect_ready(struct k_poll_set *set, struct k_poll_event *events,
+			 int num_events)
+{
+	sys_dlist_t level;
+	sys_dnode_t *node;
+	int count = 0;
+
+	sys_dlist_init(&level);
+
+	while (count < num_events &&
+	       (node = sys_dlist_get(&set->ready)) != NULL) {
+		struct k_poll_set_entry *entry =
+			CONTAINER_OF(node, struct k_poll_set_entry, ready_node);
+		struct k_poll_event *event = &events[count];
+		uint32_t state = entry->event.state;
+
+		entry->event.state = K_POLL_STATE_NOT_READY;
+
+		if ((entry->flags & K_POLL_SET_EDGE) == 0U) {
+			uint32_t level_state = K_POLL_STATE_NOT_READY;
+
+			/* Level triggered: only report the object while its
+			 * condition holds, and keep it ready until then.
+			 */
+			state &= K_POLL_STATE_CANCELLED;
+			if (is_condition_met(&entry->event, &level_state)) {
+				sys_dlist_append(&level, node);
+				state |= level_state;
+			} else if (state == K_POLL_STATE_NOT_READY) {
+				continue;
+			} else {
+				;
+			}
+		}
+
+		*event = (struct k_poll_event)
+			K_POLL_EVENT_STATIC_INITIALIZER(entry->event.type,
+							K_POLL_MODE_NOTIFY_ONLY,
+							entry->event.obj,
+							entry->event.tag);
+		event->state = state;
+		count++;
+	}
+
+	/* Level triggered objects go to the back, to be fair to others */
+	while ((node = sys_dlist_get(&level)) != NULL) {
+		sys_dlist_append(&set->ready, node);
+	}
+
+	return count;
+}
+
+int z_impl_k_poll_set_wait(struct k_poll_set *set,
+			   struct k_poll_event *events, int num_events,
+			   k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "");
+
+	if (num_events <= 0) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+
+	for (;;) {
+		ret = collect_ready(set, events, num_events);
+		if (ret > 0) {
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			ret = -EAGAIN;
+			break;
+		}
+
+		ret = z_pend_curr(&lock, key, &set->wait_q, timeout);
+		key = k_spin_lock(&lock);
+		if (ret != 0) {
+			/* Objects may have become ready as we timed out */
+			ret = collect_ready(set, events, num_events);
+			if (ret == 0) {
+				ret = -EAGAIN;
+			}
+			break;
+		}
+
+		/* Woken up for objects that may be gone already */
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	/* Let another waiter have what this one could not take */
+	if (!sys_dlist_is_empty(&set->ready) && wake_poll_set_waiter(set)) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_poll_set_add(struct k_poll_set *set,
+					uint32_t type, void *obj, uint8_t tag,
+					uint32_t flags)
+{
+	K_OOPS(K_SYSCALL_OBJ(set, K_OBJ_POLL_SET));
+
+	switch (type) {
+	case K_POLL_TYPE_SIGNAL:
+		K_OOPS(K_SYSCALL_OBJ(obj, K_OBJ_POLL_SIGNAL));
+		break;
+	case K_POLL_TYPE_SEM_AVAILABLE:
+		K_OOPS(K_SYSCALL_OBJ(obj, K_OBJ_SEM));
+		break;
+	case K_POLL_TYPE_DATA_AVAILABLE:
+		K_OOPS(K_SYSCALL_OBJ(obj, K_OBJ_QUEUE));
+		break;
+	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
+		K_OOPS(K_SYSCALL_OBJ(obj, K_OBJ_MSGQ));
+		break;
+#ifdef CONFIG_PIPES
+	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
+		K_OOPS(K_SYSCALL_OBJ(obj, K_OBJ_PIPE));
+		break;
+#endif /* CONFIG_PIPES */
+	default:
+		return -EINVAL;
+	}
+
+	return z_impl_k_poll_set_add(set, type, obj, tag, flags);
+}
+#include <syscalls/k_poll_set_add_mrsh.c>
+
+static inline int z_vrfy_k_poll_set_modify(struct k_poll_set *set, void *obj,
+					   uint8_t tag, uint32_t flags)
+{
+	K_OOPS(K_SYSCALL_OBJ(set, K_OBJ_POLL_SET));
+	return z_impl_k_poll_set_modify(set, obj, tag, flags);
+}
+#include <syscalls/k_poll_set_modify_mrsh.c>
+
+static inline int z_vrfy_k_poll_set_remove(struct k_poll_set *set, void *obj)
+{
+	K_OOPS(K_SYSCALL_OBJ(set, K_OBJ_POLL_SET));
+	return z_impl_k_poll_set_remove(set, obj);
+}
+#include <syscalls/k_poll_set_remove_mrsh.c>
+
+static inline int z_vrfy_k_poll_set_wait(struct k_poll_set *set,
+					 struct k_poll_event *events,
+					 int num_events, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(set, K_OBJ_POLL_SET));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(events, num_events,
+					    sizeof(struct k_poll_event)));
+	return z_impl_k_poll_set_wait(set, events, num_events, timeout);
+}
+#include <syscalls/k_poll_set_wait_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_POLL_SET */
@@ -63,6 +63,10 @@ void z_impl_k_queue_init(struct k_queue *queue)
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
 #endif
+#ifdef CONFIG_QUEUE_LOCKLESS
+	atomic_ptr_clear(&queue->lockless_head);
+	atomic_clear(&queue->lockless);
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_queue, queue);
 
@@ -94,6 +98,218 @@ static inline void handle_poll_events(struct k_queue *queue, uint32_t state)
 #endif /* CONFIG_POLL */
 }
 
+static inline bool queue_is_lockless(struct k_queue *queue)
+{
+#ifdef CONFIG_QUEUE_LOCKLESS
+	return (atomic_get(&queue->lockless) &
+		(Z_QUEUE_LOCKLESS_FIFO | Z_QUEUE_LOCKLESS_LIFO)) != 0;
+#else
+	ARG_UNUSED(queue);
+
+	return false;
+#endif /* CONFIG_QUEUE_LOCKLESS */
+}
+
+#ifdef CONFIG_QUEUE_LOCKLESS
+/*
+ * Producers of lockless queues push data items on the lockless_head
+ * stack with a compare-and-swap, and consumers move them to data_q under
+ * the queue lock, reversing their order for FIFO queues. Producers only
+ * take the queue lock when the WAITERS or POLLED flag is set. Consumers
+ * set these flags before they last check lockless_head, so either the
+ * consumer sees the new data item or its producer sees the flag.
+ */
+
+void z_queue_lockless_init(struct k_queue *queue, uint32_t order)
+{
+	k_queue_init(queue);
+	atomic_set(&queue->lockless, order);
+}
+
+static void queue_lockless_wake(struct k_queue *queue, size_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+	if ((atomic_get(&queue->lockless) & Z_QUEUE_LOCKLESS_WAITERS) != 0) {
+		struct k_thread *thread;
+
+		/* Woken up threads get the data items themselves, unless
+		 * other consumers got them first.
+		 */
+		while (count > 0) {
+			thread = z_unpend_first_thread(&queue->wait_q);
+			if (thread == NULL) {
+				break;
+			}
+			prepare_thread_to_run(thread, NULL);
+			count--;
+		}
+
+		if (z_waitq_head(&queue->wait_q) == NULL) {
+			(void)atomic_and(&queue->lockless,
+					 ~Z_QUEUE_LOCKLESS_WAITERS);
+		}
+	}
+
+#ifdef CONFIG_POLL
+	if ((atomic_get(&queue->lockless) & Z_QUEUE_LOCKLESS_POLLED) != 0) {
+		z_handle_queue_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
+	}
+#endif /* CONFIG_POLL */
+
+	z_reschedule(&queue->lock, key);
+}
+
+static void queue_lockless_push(struct k_queue *queue, sys_sfnode_t *first,
+				sys_sfnode_t *last, size_t count)
+{
+	void *head;
+
+	do {
+		head = atomic_ptr_get(&queue->lockless_head);
+		z_sfnode_next_set(last, head);
+	} while (!atomic_ptr_cas(&queue->lockless_head, head, first));
+
+	if ((atomic_get(&queue->lockless) &
+	     (Z_QUEUE_LOCKLESS_WAITERS | Z_QUEUE_LOCKLESS_POLLED)) != 0) {
+		queue_lockless_wake(queue, count);
+	}
+}
+
+/* must be called with the queue lock held */
+static void queue_lockless_drain(struct k_queue *queue)
+{
+	sys_sflist_t pushed;
+	sys_sfnode_t *node;
+	sys_sfnode_t *next;
+
+	if (atomic_ptr_get(&queue->lockless_head) == NULL) {
+		return;
+	}
+
+	node = atomic_ptr_set(&queue->lockless_head, NULL);
+	sys_sflist_init(&pushed);
+
+	if ((atomic_get(&queue->lockless) & Z_QUEUE_LOCKLESS_FIFO) != 0) {
+		/* Pushed items are newer than the ones in data_q */
+		for (; node != NULL; node = next) {
+			next = z_sfnode_next_peek(node);
+			sys_sflist_prepend(&pushed, node);
+		}
+		sys_sflist_merge_sflist(&queue->data_q, &pushed);
+	} else {
+		for (; node != NULL; node = next) {
+			next = z_sfnode_next_peek(node);
+			sys_sflist_append(&pushed, node);
+		}
+		sys_sflist_merge_sflist(&pushed, &queue->data_q);
+		queue->data_q = pushed;
+	}
+}
+
+static void queue_lockless_collect(struct k_queue *queue)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+	queue_lockless_drain(queue);
+	k_spin_unlock(&queue->lock, key);
+}
+
+static int32_t queue_lockless_insert(struct k_queue *queue, void *prev,
+				     void *data, bool alloc, bool is_append)
+{
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, queue_insert, queue, alloc);
+
+	__ASSERT((prev == NULL) && (is_append ==
+		 ((atomic_get(&queue->lockless) & Z_QUEUE_LOCKLESS_FIFO) != 0)),
+		 "lockless queues only take items at their tail (FIFO) or head (LIFO)");
+
+	if (alloc) {
+		struct alloc_node *anode;
+
+		anode = z_thread_malloc(sizeof(*anode));
+		if (anode == NULL) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, queue_insert, queue, alloc,
+				-ENOMEM);
+
+			return -ENOMEM;
+		}
+		anode->data = data;
+		sys_sfnode_init(&anode->node, 0x1);
+		data = anode;
+	} else {
+		sys_sfnode_init(data, 0x0);
+	}
+
+	queue_lockless_push(queue, data, data, 1);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, queue_insert, queue, alloc, 0);
+
+	return 0;
+}
+
+static void queue_lockless_append_list(struct k_queue *queue, void *head,
+				       void *tail)
+{
+	sys_sfnode_t *node = head;
+	sys_sfnode_t *prev = NULL;
+	sys_sfnode_t *next;
+	size_t count = 0;
+
+	__ASSERT((atomic_get(&queue->lockless) & Z_QUEUE_LOCKLESS_FIFO) != 0,
+		 "lists can only be appended to lockless FIFO queues");
+
+	/* Pushed items are linked newest first */
+	while (true) {
+		next = z_sfnode_next_peek(node);
+		z_sfnode_next_set(node, prev);
+		count++;
+		if (node == tail) {
+			break;
+		}
+		prev = node;
+		node = next;
+	}
+
+	queue_lockless_push(queue, tail, head, count);
+}
+
+static void *queue_lockless_get(struct k_queue *queue, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	sys_sfnode_t *node;
+
+	while (true) {
+		if (((atomic_get(&queue->lockless) & Z_QUEUE_LOCKLESS_LIFO) != 0) ||
+		    sys_sflist_is_empty(&queue->data_q)) {
+			queue_lockless_drain(queue);
+		}
+
+		node = sys_sflist_get(&queue->data_q);
+		if ((node != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			break;
+		}
+
+		(void)atomic_or(&queue->lockless, Z_QUEUE_LOCKLESS_WAITERS);
+		if (atomic_ptr_get(&queue->lockless_head) != NULL) {
+			continue;
+		}
+
+		if (z_pend_curr(&queue->lock, key, &queue->wait_q, timeout) != 0) {
+			return NULL;
+		}
+
+		timeout = sys_timepoint_timeout(end);
+		key = k_spin_lock(&queue->lock);
+	}
+
+	k_spin_unlock(&queue->lock, key);
+
+	return z_queue_node_peek(node, true);
+}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 {
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, cancel_wait, queue);
@@ -104,7 +320,10 @@ void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 	first_pending_thread = z_unpend_first_thread(&queue->wait_q);
 
 	if (first_pending_thread != NULL) {
-		prepare_thread_to_run(first_pending_thread, NULL);
+		/* Fail the wait, lockless queue consumers would retry it */
+		z_thread_return_value_set_with_data(first_pending_thread,
+						    -ECANCELED, NULL);
+		z_ready_thread(first_pending_thread);
 	}
 
 	handle_poll_events(queue, K_POLL_STATE_CANCELLED);
@@ -124,7 +343,15 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 			    bool alloc, bool is_append)
 {
 	struct k_thread *first_pending_thread;
-	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	k_spinlock_key_t key;
+
+#ifdef CONFIG_QUEUE_LOCKLESS
+	if (queue_is_lockless(queue)) {
+		return queue_lockless_insert(queue, prev, data, alloc, is_append);
+	}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
+	key = k_spin_lock(&queue->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, queue_insert, queue, alloc);
 
@@ -255,6 +482,16 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_QUEUE_LOCKLESS
+	if (queue_is_lockless(queue)) {
+		queue_lockless_append_list(queue, head, tail);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, append_list, queue, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	struct k_thread *thread = NULL;
 
@@ -316,9 +553,23 @@ int k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list)
 
 void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	k_spinlock_key_t key;
 	void *data;
 
+#ifdef CONFIG_QUEUE_LOCKLESS
+	if (queue_is_lockless(queue)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get, queue, timeout);
+
+		data = queue_lockless_get(queue, timeout);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout, data);
+
+		return data;
+	}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
+	key = k_spin_lock(&queue->lock);
+
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get, queue, timeout);
 
 	if (likely(!sys_sflist_is_empty(&queue->data_q))) {
@@ -355,6 +606,9 @@ bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
 
+	__ASSERT(!queue_is_lockless(queue),
+		 "items cannot be removed from lockless queues");
+
 	bool ret = sys_sflist_find_and_remove(&queue->data_q, (sys_sfnode_t *)data);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, remove, queue, ret);
@@ -366,6 +620,9 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, unique_append, queue);
 
+	__ASSERT(!queue_is_lockless(queue),
+		 "lockless queues cannot be searched for an item");
+
 	sys_sfnode_t *test;
 
 	SYS_SFLIST_FOR_EACH_NODE(&queue->data_q, test) {
@@ -385,6 +642,12 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 
 void *z_impl_k_queue_peek_head(struct k_queue *queue)
 {
+#ifdef CONFIG_QUEUE_LOCKLESS
+	if (queue_is_lockless(queue)) {
+		queue_lockless_collect(queue);
+	}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_head(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_head, queue, ret);
@@ -394,6 +657,12 @@ void *z_impl_k_queue_peek_head(struct k_queue *queue)
 
 void *z_impl_k_queue_peek_tail(struct k_queue *queue)
 {
+#ifdef CONFIG_QUEUE_LOCKLESS
+	if (queue_is_lockless(queue)) {
+		queue_lockless_collect(queue);
+	}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_tail(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_tail, queue, ret);
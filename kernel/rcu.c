@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief read-copy-update deferred reclamation
+ *
+ * Read-side critical sections mask interrupts, so a CPU can't be in one
+ * when it schedules, i.e. when it context switches or exits an interrupt.
+ * Each CPU counts these quiescent states in its rcu_qs field. A grace
+ * period has elapsed once every other CPU has reported a quiescent state
+ * since it started: the CPU checking it is in one, being in thread context.
+ *
+ * Callbacks are batched. Those queued while a grace period is in progress
+ * wait for the next one, which starts when the current one ends. Grace
+ * periods are driven from a delayable work item on the system work queue,
+ * which kicks the other CPUs through an interrupt exit with an IPI so that
+ * idle CPUs don't hold them up.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/sys/slist.h>
+#include <ipi.h>
+
+static struct k_spinlock lock;
+
+/* Callbacks waiting for the grace period in progress */
+static sys_slist_t cur_batch;
+
+/* Callbacks waiting for the next grace period */
+static sys_slist_t next_batch;
+
+/* Quiescent state counts of the CPUs when the grace period started */
+static atomic_val_t gp_start_qs[CONFIG_MP_MAX_NUM_CPUS];
+
+static void rcu_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(rcu_work, rcu_work_handler);
+
+/* must be called with the lock held */
+static void gp_start(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		gp_start_qs[i] = atomic_get(&_kernel.cpus[i].rcu_qs);
+	}
+}
+
+/* must be called with the lock held */
+static bool gp_done(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct _cpu *cpu = &_kernel.cpus[i];
+
+		/* The current CPU is in a quiescent state, and CPUs that
+		 * have not been started can't be in a critical section.
+		 */
+		if ((cpu == _current_cpu) || (cpu->current == NULL)) {
+			continue;
+		}
+
+		if (atomic_get(&cpu->rcu_qs) == gp_start_qs[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void rcu_work_handler(struct k_work *work)
+{
+	struct k_rcu_head *head, *next;
+	k_spinlock_key_t key;
+	sys_slist_t done;
+	bool in_progress;
+
+	ARG_UNUSED(work);
+
+	sys_slist_init(&done);
+
+	key = k_spin_lock(&lock);
+
+	while (true) {
+		if (!sys_slist_is_empty(&cur_batch)) {
+			if (!gp_done()) {
+				break;
+			}
+			sys_slist_merge_slist(&done, &cur_batch);
+		}
+
+		if (sys_slist_is_empty(&next_batch)) {
+			break;
+		}
+
+		sys_slist_merge_slist(&cur_batch, &next_batch);
+		gp_start();
+	}
+
+	in_progress = !sys_slist_is_empty(&cur_batch);
+
+	k_spin_unlock(&lock, key);
+
+	if (in_progress) {
+		flag_ipi(IPI_ALL_CPUS_MASK);
+		signal_pending_ipi();
+		(void)k_work_schedule(&rcu_work, K_TICKS(1));
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&done, head, next, node) {
+		head->func(head);
+	}
+}
+
+void k_rcu_call(struct k_rcu_head *head, k_rcu_callback_t func)
+{
+	head->func = func;
+
+	K_SPINLOCK(&lock) {
+		sys_slist_append(&next_batch, &head->node);
+	}
+
+	(void)k_work_schedule(&rcu_work, K_NO_WAIT);
+}
+
+struct rcu_sync {
+	struct k_rcu_head head;
+	struct k_sem sem;
+};
+
+static void rcu_sync_callback(struct k_rcu_head *head)
+{
+	struct rcu_sync *sync = CONTAINER_OF(head, struct rcu_sync, head);
+
+	k_sem_give(&sync->sem);
+}
+
+void k_rcu_synchronize(void)
+{
+	struct rcu_sync sync;
+
+	__ASSERT(!k_is_in_isr(), "can't wait for a grace period in an ISR");
+	__ASSERT(k_current_get() != k_work_queue_thread_get(&k_sys_work_q),
+		 "grace periods are driven from the system work queue");
+
+	k_sem_init(&sync.sem, 0, 1);
+	k_rcu_call(&sync.head, rcu_sync_callback);
+	(void)k_sem_take(&sync.sem, K_FOREVER);
+}
@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief reader-writer locks
+ *
+ * Any number of readers may hold a reader-writer lock at the same time,
+ * while a writer owns it exclusively. Readers and writers wait on separate
+ * wait queues. When the lock is released, it is handed over either to the
+ * first waiting writer or to all the waiting readers, depending on the
+ * K_RWLOCK_PREFER_WRITER flag, so woken threads never have to retry.
+ *
+ * As with mutexes, the writer owning the lock inherits the priority of the
+ * threads waiting for it. Readers are not tracked individually, so their
+ * priority is never raised.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/toolchain.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/check.h>
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+static struct k_obj_type obj_type_rwlock;
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
+
+int z_impl_k_rwlock_init(struct k_rwlock *rwlock, uint32_t flags)
+{
+	if ((flags & ~K_RWLOCK_PREFER_WRITER) != 0U) {
+		return -EINVAL;
+	}
+
+	z_waitq_init(&rwlock->rd_wait_q);
+	z_waitq_init(&rwlock->wr_wait_q);
+	rwlock->owner = NULL;
+	rwlock->readers = 0U;
+	rwlock->owner_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO;
+	rwlock->flags = flags;
+
+	k_object_init(rwlock);
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+	k_obj_core_init_and_link(K_OBJ_CORE(rwlock), &obj_type_rwlock);
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_init(struct k_rwlock *rwlock, uint32_t flags)
+{
+	K_OOPS(K_SYSCALL_OBJ_INIT(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_init(rwlock, flags);
+}
+#include <syscalls/k_rwlock_init_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+static inline bool prefer_writer(struct k_rwlock *rwlock)
+{
+	return (rwlock->flags & K_RWLOCK_PREFER_WRITER) != 0U;
+}
+
+static bool set_owner_prio(struct k_rwlock *rwlock, int32_t new_prio)
+{
+	if (rwlock->owner->base.prio != new_prio) {
+		return z_thread_prio_set(rwlock->owner, new_prio);
+	}
+	return false;
+}
+
+static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
+{
+	int new_prio = z_is_prio_higher(target, limit) ? target : limit;
+
+	return z_get_new_prio_with_ceiling(new_prio);
+}
+
+/* must be called with the lock held */
+static void boost_owner_prio(struct k_rwlock *rwlock)
+{
+	int32_t new_prio;
+
+	if (rwlock->owner == NULL) {
+		return;
+	}
+
+	new_prio = new_prio_for_inheritance(_current->base.prio,
+					    rwlock->owner->base.prio);
+	if (z_is_prio_higher(new_prio, rwlock->owner->base.prio)) {
+		(void)set_owner_prio(rwlock, new_prio);
+	}
+}
+
+/*
+ * Recompute the priority of the writer owning the lock from the threads
+ * still waiting for it, after one of them gave up.
+ *
+ * Must be called with the lock held.
+ */
+static bool restore_owner_prio(struct k_rwlock *rwlock)
+{
+	struct k_thread *waiter;
+	int32_t new_prio;
+
+	if (rwlock->owner == NULL) {
+		return false;
+	}
+
+	new_prio = rwlock->owner_orig_prio;
+
+	waiter = z_waitq_head(&rwlock->rd_wait_q);
+	if (waiter != NULL) {
+		new_prio = new_prio_for_inheritance(waiter->base.prio, new_prio);
+	}
+
+	waiter = z_waitq_head(&rwlock->wr_wait_q);
+	if (waiter != NULL) {
+		new_prio = new_prio_for_inheritance(waiter->base.prio, new_prio);
+	}
+
+	return set_owner_prio(rwlock, new_prio);
+}
+
+/*
+ * Hand the lock over to the waiting threads it can be granted to, if it is
+ * not owned by a writer. Returns true if any thread was made ready.
+ *
+ * Must be called with the lock held.
+ */
+static bool grant(struct k_rwlock *rwlock)
+{
+	struct k_thread *thread;
+	bool readied = false;
+
+	if (rwlock->owner != NULL) {
+		return false;
+	}
+
+	if ((rwlock->readers == 0U) &&
+	    (prefer_writer(rwlock) ||
+	     (z_waitq_head(&rwlock->rd_wait_q) == NULL))) {
+		thread = z_unpend_first_thread(&rwlock->wr_wait_q);
+		if (thread != NULL) {
+			rwlock->owner = thread;
+			rwlock->owner_orig_prio = thread->base.prio;
+			arch_thread_return_value_set(thread, 0);
+			z_ready_thread(thread);
+			return true;
+		}
+	}
+
+	if (prefer_writer(rwlock) &&
+	    (z_waitq_head(&rwlock->wr_wait_q) != NULL)) {
+		return false;
+	}
+
+	while ((thread = z_unpend_first_thread(&rwlock->rd_wait_q)) != NULL) {
+		rwlock->readers++;
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		readied = true;
+	}
+
+	return readied;
+}
+
+int z_impl_k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&rwlock->lock);
+
+	if (likely((rwlock->owner == NULL) &&
+		   (!prefer_writer(rwlock) ||
+		    (z_waitq_head(&rwlock->wr_wait_q) == NULL)))) {
+		rwlock->readers++;
+		k_spin_unlock(&rwlock->lock, key);
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&rwlock->lock, key);
+		return -EBUSY;
+	}
+
+	boost_owner_prio(rwlock);
+
+	ret = z_pend_curr(&rwlock->lock, key, &rwlock->rd_wait_q, timeout);
+	if (ret == 0) {
+		return 0;
+	}
+
+	/* timed out */
+
+	key = k_spin_lock(&rwlock->lock);
+
+	if (restore_owner_prio(rwlock)) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_lock(struct k_rwlock *rwlock,
+					    k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_lock(rwlock, timeout);
+}
+#include <syscalls/k_rwlock_read_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&rwlock->lock);
+
+	if (unlikely(rwlock->readers == 0U)) {
+		k_spin_unlock(&rwlock->lock, key);
+		return -EINVAL;
+	}
+
+	rwlock->readers--;
+
+	if ((rwlock->readers == 0U) && grant(rwlock)) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_unlock(rwlock);
+}
+#include <syscalls/k_rwlock_read_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	bool resched;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&rwlock->lock);
+
+	if (likely((rwlock->owner == NULL) && (rwlock->readers == 0U))) {
+		rwlock->owner = _current;
+		rwlock->owner_orig_prio = _current->base.prio;
+		k_spin_unlock(&rwlock->lock, key);
+		return 0;
+	}
+
+	if (rwlock->owner == _current) {
+		k_spin_unlock(&rwlock->lock, key);
+		return -EDEADLK;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&rwlock->lock, key);
+		return -EBUSY;
+	}
+
+	boost_owner_prio(rwlock);
+
+	ret = z_pend_curr(&rwlock->lock, key, &rwlock->wr_wait_q, timeout);
+	if (ret == 0) {
+		return 0;
+	}
+
+	/* timed out */
+
+	key = k_spin_lock(&rwlock->lock);
+
+	resched = restore_owner_prio(rwlock);
+
+	/* Readers may have been waiting behind this writer */
+	resched = grant(rwlock) || resched;
+
+	if (resched) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_lock(struct k_rwlock *rwlock,
+					     k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_lock(rwlock, timeout);
+}
+#include <syscalls/k_rwlock_write_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+	bool resched;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	CHECKIF(rwlock->owner != _current) {
+		return -EPERM;
+	}
+
+	key = k_spin_lock(&rwlock->lock);
+
+	resched = set_owner_prio(rwlock, rwlock->owner_orig_prio);
+	rwlock->owner = NULL;
+	resched = grant(rwlock) || resched;
+
+	if (resched) {
+		z_reschedule(&rwlock->lock, key);
+	} else {
+		k_spin_unlock(&rwlock->lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_unlock(rwlock);
+}
+#include <syscalls/k_rwlock_write_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+static int init_rwlock_obj_core_list(void)
+{
+	/* Initialize rwlock object type */
+
+	z_obj_type_init(&obj_type_rwlock, K_OBJ_TYPE_RWLOCK_ID,
+			offsetof(struct k_rwlock, obj_core));
+
+	/* Initialize and link statically defined rwlocks */
+
+	STRUCT_SECTION_FOREACH(k_rwlock, rwlock) {
+		k_obj_core_init_and_link(K_OBJ_CORE(rwlock), &obj_type_rwlock);
+	}
+
+	return 0;
+}
+
+SYS_INIT(init_rwlock_obj_core_list, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
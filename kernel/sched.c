@@ -96,6 +96,8 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	return &_kernel.cpus[thread->base.cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
@@ -104,30 +106,156 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_PER_CPU_RUNQ */
+}
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+/* Each CPU's run queue has its own lock, taken along with
+ * _sched_spinlock to modify it, so that a CPU can find out whether it
+ * has a better thread to run than its current one without taking
+ * _sched_spinlock, see current_stays().  The priority of the best
+ * thread of each run queue (RUNQ_EMPTY_PRIO if empty) is published so
+ * that CPUs only look into the other run queues, to steal threads, when
+ * they might hold a better one than their own.
+ */
+#define RUNQ_EMPTY_PRIO INT_MAX
+
+static struct k_spinlock runq_locks[CONFIG_MP_MAX_NUM_CPUS];
+static atomic_t runq_best_prio[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Call with runq_locks[cpu] held */
+static void runq_best_prio_update(int cpu)
+{
+	struct k_thread *head = _priq_run_head(&_kernel.cpus[cpu].ready_q.runq);
+
+	atomic_set(&runq_best_prio[cpu],
+		   (head == NULL) ? RUNQ_EMPTY_PRIO : head->base.prio);
+}
+
+/* True if a CPU is up and running a thread the given one may preempt */
+static bool cpu_preemptible_by(int cpu, struct k_thread *thread)
+{
+	struct k_thread *curr = _kernel.cpus[cpu].current;
+
+	return (curr != NULL) &&
+	       (thread_is_preemptible(curr) || thread_is_metairq(thread));
 }
 
+/* Picks the run queue for a thread becoming runnable: the one of the
+ * CPU running the lowest priority preemptible thread among the CPUs
+ * the thread may run on, favoring the CPU it last ran on on ties.
+ * Wherever it lands, CPUs with nothing better to do will find it in
+ * runq_best().
+ */
+static int runq_cpu_select(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint32_t mask = BIT_MASK(num_cpus);
+	int cpu = thread->base.cpu;
+	struct k_thread *lowest = NULL;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	mask &= thread->base.cpu_mask;
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+	/* Same edge case as in thread_runq() with PIN_ONLY: a thread
+	 * with all CPUs masked off, which no CPU will ever pick.
+	 */
+	if (mask == 0) {
+		return cpu;
+	}
+
+	if ((mask & BIT(cpu)) == 0) {
+		cpu = u32_count_trailing_zeros(mask);
+	}
+	if (cpu_preemptible_by(cpu, thread)) {
+		lowest = _kernel.cpus[cpu].current;
+	}
+
+	for (int i = 0; i < num_cpus; i++) {
+		struct k_thread *curr = _kernel.cpus[i].current;
+
+		if (((mask & BIT(i)) != 0) && cpu_preemptible_by(i, thread) &&
+		    ((lowest == NULL) || (z_sched_prio_cmp(lowest, curr) > 0))) {
+			lowest = curr;
+			cpu = i;
+		}
+	}
+
+	return cpu;
+}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	int cpu = runq_cpu_select(thread);
+
+	K_SPINLOCK(&runq_locks[cpu]) {
+		thread->base.cpu = cpu;
+		_priq_run_add(thread_runq(thread), thread);
+		runq_best_prio_update(cpu);
+	}
+#else
 	_priq_run_add(thread_runq(thread), thread);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	int cpu = thread->base.cpu;
+
+	K_SPINLOCK(&runq_locks[cpu]) {
+		_priq_run_remove(thread_runq(thread), thread);
+		runq_best_prio_update(cpu);
+	}
+#else
 	_priq_run_remove(thread_runq(thread), thread);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
+/* Call with _sched_spinlock held, which is enough to read any run queue */
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	struct k_thread *thread = _priq_run_best(curr_cpu_runq());
+	unsigned int num_cpus = arch_num_cpus();
+
+	/* Work stealing: run the best thread this CPU may run,
+	 * wherever it is queued.  Local threads win ties, and
+	 * _priq_run_best() only returns threads whose CPU mask
+	 * includes this CPU.  Run queues whose best thread has a
+	 * lower priority than the local one are skipped.
+	 */
+	for (int i = 0; i < num_cpus; i++) {
+		int prio = (int)atomic_get(&runq_best_prio[i]);
+		struct k_thread *t;
+
+		if ((i == _current_cpu->id) || (prio == RUNQ_EMPTY_PRIO) ||
+		    ((thread != NULL) && (prio > thread->base.prio))) {
+			continue;
+		}
+
+		t = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+		if ((t != NULL) &&
+		    ((thread == NULL) || (z_sched_prio_cmp(t, thread) > 0))) {
+			thread = t;
+		}
+	}
+
+	return thread;
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 /* _current is never in the run queue until context switch on
@@ -366,6 +494,29 @@ static bool thread_active_elsewhere(struct k_thread *thread)
 	return false;
 }
 
+/* CPUs which may have to reschedule after a thread is made ready */
+static inline uint32_t ipi_mask_create(struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	int cpu = thread->base.cpu;
+
+	/* No other CPU than the one runq_cpu_select() queued the
+	 * thread on would switch to it if that one doesn't
+	 */
+	if (z_is_thread_queued(thread) && (thread != _current) &&
+	    (cpu != _current_cpu->id) && cpu_preemptible_by(cpu, thread) &&
+	    (z_sched_prio_cmp(thread, _kernel.cpus[cpu].current) > 0)) {
+		return IPI_CPU_MASK(cpu);
+	}
+
+	return 0;
+#else
+	ARG_UNUSED(thread);
+
+	return IPI_ALL_CPUS_MASK;
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+}
+
 static void ready_thread(struct k_thread *thread)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
@@ -378,9 +529,12 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+		z_sched_latency_ready(thread);
+#endif /* CONFIG_SCHED_LATENCY_STATS */
 		queue_thread(thread);
 		update_cache(0);
-		flag_ipi();
+		flag_ipi(ipi_mask_create(thread));
 	}
 }
 
@@ -750,6 +904,14 @@ bool z_thread_prio_set(struct k_thread *thread, int prio)
 				thread->base.prio = prio;
 			}
 			update_cache(1);
+		} else if (z_is_thread_pending(thread) &&
+			   (thread->base.pended_on != NULL)) {
+			/* Wait queues are ordered by priority too */
+			_wait_q_t *wait_q = pended_on_thread(thread);
+
+			_priq_wait_remove(&wait_q->waitq, thread);
+			thread->base.prio = prio;
+			_priq_wait_add(&wait_q->waitq, thread);
 		} else {
 			thread->base.prio = prio;
 		}
@@ -857,9 +1019,56 @@ struct k_thread *z_swap_next_thread(void)
 static inline void set_current(struct k_thread *new_thread)
 {
 	z_thread_mark_switched_out();
+#ifdef CONFIG_SMP
+	new_thread->base.cpu = arch_curr_cpu()->id;
+#endif /* CONFIG_SMP */
 	_current_cpu->current = new_thread;
 }
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+/* Finds out, without taking _sched_spinlock, whether next_up() would
+ * keep the current thread, e.g. on interrupt exits with nothing new to
+ * run.  Whatever may change that afterwards (a thread queued to this
+ * CPU, a halt request, a priority change) comes with an IPI to this
+ * CPU, which will check again, so false is only ever a hint that
+ * next_up() has to decide.
+ */
+static bool current_stays(void)
+{
+	struct k_thread *curr = _current;
+	int cpu = _current_cpu->id;
+	bool stays = false;
+
+	if (_current_cpu->swap_ok || is_halting(curr) ||
+	    z_is_thread_prevented_from_running(curr)) {
+		return false;
+	}
+
+#if (CONFIG_NUM_METAIRQ_PRIORITIES > 0) &&                                                         \
+	(CONFIG_NUM_COOP_PRIORITIES > CONFIG_NUM_METAIRQ_PRIORITIES)
+	if (_current_cpu->metairq_preempted != NULL) {
+		return false;
+	}
+#endif
+
+	K_SPINLOCK(&runq_locks[cpu]) {
+		struct k_thread *best = _priq_run_best(curr_cpu_runq());
+
+		/* Same test as in next_up(), ties keep _current */
+		stays = (best == NULL) || (z_sched_prio_cmp(curr, best) >= 0);
+	}
+
+	for (int i = 0; stays && (i < arch_num_cpus()); i++) {
+		if ((i != cpu) &&
+		    ((int)atomic_get(&runq_best_prio[i]) <= curr->base.prio)) {
+			stays = false;
+		}
+	}
+
+	return stays;
+}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 /**
  * @brief Determine next thread to execute upon completion of an interrupt
  *
@@ -898,6 +1107,15 @@ void *z_get_next_switch_handle(void *interrupted)
 #ifdef CONFIG_SMP
 	void *ret = NULL;
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	if (current_stays()) {
+		z_rcu_quiescent_state();
+		z_sched_usage_switch(_current);
+		signal_pending_ipi();
+		return interrupted;
+	}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 	K_SPINLOCK(&_sched_spinlock) {
 		struct k_thread *old_thread = _current, *new_thread;
 
@@ -906,6 +1124,7 @@ void *z_get_next_switch_handle(void *interrupted)
 		}
 		new_thread = next_up();
 
+		z_rcu_quiescent_state();
 		z_sched_usage_switch(new_thread);
 
 		if (old_thread != new_thread) {
@@ -980,7 +1199,7 @@ void init_ready_q(struct _ready_q *ready_q)
 		}
 	};
 #elif defined(CONFIG_SCHED_MULTIQ)
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
+	for (int i = 0; i < ARRAY_SIZE(ready_q->runq.queues); i++) {
 		sys_dlist_init(&ready_q->runq.queues[i]);
 	}
 #else
@@ -990,13 +1209,16 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+		atomic_set(&runq_best_prio[i], RUNQ_EMPTY_PRIO);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
@@ -1010,7 +1232,7 @@ void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
 
 	bool need_sched = z_thread_prio_set((struct k_thread *)thread, prio);
 
-	flag_ipi();
+	flag_ipi(IPI_ALL_CPUS_MASK);
 	if (need_sched && _current->base.sched_locked == 0U) {
 		z_reschedule_unlocked();
 	}
@@ -1105,9 +1327,13 @@ static inline void z_vrfy_k_yield(void)
 static int32_t z_tick_sleep(k_ticks_t ticks)
 {
 	uint32_t expected_wakeup_ticks;
+	k_timeout_t timeout = Z_TIMEOUT_TICKS(ticks);
 
 	__ASSERT(!arch_is_in_isr(), "");
 
+	/* Slack only matters to the timeout queue */
+	ticks = Z_TICK_NO_SLACK(ticks);
+
 	LOG_DBG("thread %p for %lu ticks", _current, (unsigned long)ticks);
 
 	/* wait of 0 ms is treated as a 'yield' */
@@ -1122,7 +1348,6 @@ static int32_t z_tick_sleep(k_ticks_t ticks)
 		expected_wakeup_ticks = Z_TICK_ABS(ticks);
 	}
 
-	k_timeout_t timeout = Z_TIMEOUT_TICKS(ticks);
 	k_spinlock_key_t key = k_spin_lock(&_sched_spinlock);
 
 #if defined(CONFIG_TIMESLICING) && defined(CONFIG_SWAP_NONATOMIC)
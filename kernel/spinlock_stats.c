@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief spinlock statistics
+ *
+ * Statistics are kept per call site, i.e. per return address of the hook
+ * called from the inlined k_spin_lock(), in a table indexed by a hash of
+ * that address. Entries are claimed on first use and never released. A
+ * lock records the entry of the call site holding it, so that the hold
+ * time can be accounted for when it is released.
+ *
+ * The same call site may take different locks on different CPUs at the
+ * same time, so entries are protected by a flag of their own, which can't
+ * be a spinlock since those are the ones being measured. For the same
+ * reason, locks taken by the timing functions while statistics are being
+ * recorded aren't recorded themselves.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/init.h>
+#include <zephyr/timing/timing.h>
+
+struct stats_entry {
+	atomic_t busy;
+	struct k_spinlock_stats stats;
+};
+
+static struct stats_entry entries[CONFIG_SPIN_LOCK_STATS_ENTRIES];
+static atomic_t dropped;
+
+/* Set once the timing functions have been started */
+static bool enabled;
+
+/* Set on a CPU while it records statistics */
+static bool recording[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Timing counter value when a CPU started spinning, if it is */
+static timing_t spin_start[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Must be called with interrupts masked */
+static bool record_begin(void)
+{
+	if (!enabled || recording[_current_cpu->id]) {
+		return false;
+	}
+
+	recording[_current_cpu->id] = true;
+	return true;
+}
+
+static void record_end(void)
+{
+	recording[_current_cpu->id] = false;
+}
+
+/* Must be called with interrupts masked */
+static void entry_lock(struct stats_entry *entry)
+{
+	while (!atomic_cas(&entry->busy, 0, 1)) {
+		arch_spin_relax();
+	}
+}
+
+static void entry_unlock(struct stats_entry *entry)
+{
+	atomic_clear(&entry->busy);
+}
+
+static struct stats_entry *entry_get(void *site)
+{
+	unsigned int i = ((uintptr_t)site >> 2) % CONFIG_SPIN_LOCK_STATS_ENTRIES;
+
+	for (unsigned int n = 0; n < CONFIG_SPIN_LOCK_STATS_ENTRIES; n++) {
+		struct stats_entry *entry = &entries[i];
+		atomic_ptr_t *key = (atomic_ptr_t *)&entry->stats.site;
+		void *cur = atomic_ptr_get(key);
+
+		if ((cur == NULL) && atomic_ptr_cas(key, NULL, site)) {
+			return entry;
+		}
+
+		if (atomic_ptr_get(key) == site) {
+			return entry;
+		}
+
+		i = (i + 1U) % CONFIG_SPIN_LOCK_STATS_ENTRIES;
+	}
+
+	atomic_inc(&dropped);
+
+	return NULL;
+}
+
+void z_spin_lock_stats_contended(struct k_spinlock *l)
+{
+	ARG_UNUSED(l);
+
+	if (!record_begin()) {
+		return;
+	}
+
+	spin_start[_current_cpu->id] = timing_counter_get();
+
+	record_end();
+}
+
+void z_spin_lock_stats_acquired(struct k_spinlock *l, bool contended)
+{
+	void *site = __builtin_return_address(0);
+	struct stats_entry *entry;
+	timing_t *start;
+	timing_t now;
+	uint64_t spin = 0U;
+
+	l->stats_entry = NULL;
+
+	if (!record_begin()) {
+		return;
+	}
+
+	start = &spin_start[_current_cpu->id];
+	if (contended && (*start != 0U)) {
+		now = timing_counter_get();
+		spin = timing_cycles_get(start, &now);
+	}
+	*start = 0U;
+
+	entry = entry_get(site);
+	if (entry != NULL) {
+		entry_lock(entry);
+		entry->stats.lock = l;
+		entry->stats.acquired++;
+		if (contended) {
+			entry->stats.contended++;
+			entry->stats.spin_cycles += spin;
+			entry->stats.spin_cycles_max =
+				MAX(entry->stats.spin_cycles_max, spin);
+		}
+		entry_unlock(entry);
+
+		l->stats_entry = entry;
+		l->stats_start = timing_counter_get();
+	}
+
+	record_end();
+}
+
+void z_spin_lock_stats_released(struct k_spinlock *l)
+{
+	struct stats_entry *entry = l->stats_entry;
+	timing_t now;
+	uint64_t hold;
+
+	if (entry == NULL) {
+		return;
+	}
+
+	l->stats_entry = NULL;
+
+	if (!record_begin()) {
+		return;
+	}
+
+	now = timing_counter_get();
+	hold = timing_cycles_get(&l->stats_start, &now);
+
+	entry_lock(entry);
+	entry->stats.hold_cycles += hold;
+	entry->stats.hold_cycles_max = MAX(entry->stats.hold_cycles_max, hold);
+	entry_unlock(entry);
+
+	record_end();
+}
+
+void k_spinlock_stats_foreach(k_spinlock_stats_cb_t cb, void *user_data)
+{
+	struct k_spinlock_stats stats;
+	unsigned int key;
+
+	for (unsigned int i = 0; i < CONFIG_SPIN_LOCK_STATS_ENTRIES; i++) {
+		struct stats_entry *entry = &entries[i];
+
+		if (atomic_ptr_get((atomic_ptr_t *)&entry->stats.site) == NULL) {
+			continue;
+		}
+
+		key = arch_irq_lock();
+		entry_lock(entry);
+		stats = entry->stats;
+		entry_unlock(entry);
+		arch_irq_unlock(key);
+
+		if (stats.acquired != 0U) {
+			cb(&stats, user_data);
+		}
+	}
+}
+
+void k_spinlock_stats_reset(void)
+{
+	unsigned int key;
+
+	for (unsigned int i = 0; i < CONFIG_SPIN_LOCK_STATS_ENTRIES; i++) {
+		struct stats_entry *entry = &entries[i];
+
+		/* Call sites keep their entries */
+		key = arch_irq_lock();
+		entry_lock(entry);
+		entry->stats.acquired = 0U;
+		entry->stats.contended = 0U;
+		entry->stats.hold_cycles = 0U;
+		entry->stats.hold_cycles_max = 0U;
+		entry->stats.spin_cycles = 0U;
+		entry->stats.spin_cycles_max = 0U;
+		entry_unlock(entry);
+		arch_irq_unlock(key);
+	}
+
+	atomic_clear(&dropped);
+}
+
+uint32_t k_spinlock_stats_dropped(void)
+{
+	return (uint32_t)atomic_get(&dropped);
+}
+
+static void trace_entry(const struct k_spinlock_stats *stats, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	SYS_PORT_TRACING_FUNC(k_spinlock, stats, stats);
+}
+
+void k_spinlock_stats_trace(void)
+{
+	k_spinlock_stats_foreach(trace_entry, NULL);
+}
+
+static int spin_lock_stats_init(void)
+{
+	/* The timing functions are started before the POST_KERNEL level */
+	enabled = true;
+
+	return 0;
+}
+
+SYS_INIT(spin_lock_stats_init, POST_KERNEL, 0);
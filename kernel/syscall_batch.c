@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/speculation.h>
+#include <zephyr/sys/syscall_batch.h>
+#include <inttypes.h>
+
+int z_impl_k_syscall_batch(struct k_syscall_desc *descs, size_t count)
+{
+	ARG_UNUSED(descs);
+	ARG_UNUSED(count);
+
+	/* Supervisor threads have nothing to gain from batching */
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_desc *descs,
+					 size_t count)
+{
+	void *ssf = _current->syscall_frame;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(descs, count, sizeof(*descs)));
+
+	for (size_t i = 0; i < count; i++) {
+		/* Work on a copy, the caller can change the array under us */
+		struct k_syscall_desc desc = descs[i];
+		uintptr_t ret;
+
+		K_OOPS(K_SYSCALL_VERIFY_MSG(desc.id < K_SYSCALL_LIMIT &&
+					    desc.id != K_SYSCALL_K_SYSCALL_BATCH,
+					    "bad system call id %" PRIuPTR
+					    " in batch", desc.id));
+		desc.id = k_array_index_sanitize(desc.id, K_SYSCALL_LIMIT);
+
+		ret = _k_syscall_table[desc.id](desc.args[0], desc.args[1],
+						desc.args[2], desc.args[3],
+						desc.args[4], desc.args[5],
+						ssf);
+
+		/* Each unmarshalling function clears the frame on return */
+		_current->syscall_frame = ssf;
+		descs[i].ret = ret;
+	}
+
+	return 0;
+}
+#include <syscalls/k_syscall_batch_mrsh.c>
@@ -19,17 +19,35 @@ static K_KERNEL_STACK_DEFINE(sys_work_q_stack,
 
 struct k_work_q k_sys_work_q;
 
+#if defined(CONFIG_SYSTEM_WORKQUEUE_THREADS) && (CONFIG_SYSTEM_WORKQUEUE_THREADS > 1)
+#define SYS_WORK_Q_WORKERS (CONFIG_SYSTEM_WORKQUEUE_THREADS - 1)
+
+static K_KERNEL_STACK_ARRAY_DEFINE(sys_work_q_worker_stacks, SYS_WORK_Q_WORKERS,
+				   CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+
+static struct k_work_q_worker sys_work_q_workers[SYS_WORK_Q_WORKERS];
+#endif
+
 static int k_sys_work_q_init(void)
 {
 	struct k_work_queue_config cfg = {
 		.name = "sysworkq",
 		.no_yield = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_NO_YIELD),
+		.pin_cpus = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_PIN_CPUS),
 	};
 
 	k_work_queue_start(&k_sys_work_q,
 			    sys_work_q_stack,
 			    K_KERNEL_STACK_SIZEOF(sys_work_q_stack),
 			    CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+
+#ifdef SYS_WORK_Q_WORKERS
+	for (int i = 0; i < SYS_WORK_Q_WORKERS; i++) {
+		k_work_queue_worker_add(&k_sys_work_q, &sys_work_q_workers[i],
+					sys_work_q_worker_stacks[i],
+					K_KERNEL_STACK_SIZEOF(sys_work_q_worker_stacks[i]));
+	}
+#endif
 	return 0;
 }
 
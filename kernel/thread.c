@@ -647,6 +647,11 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 		CONFIG_SCHED_THREAD_USAGE_AUTO_ENABLE;
 #endif /* CONFIG_SCHED_THREAD_USAGE */
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	new_thread->base.latency_start = 0U;
+	new_thread->base.latency = (struct k_sched_latency_stats) {};
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 	SYS_PORT_TRACING_OBJ_FUNC(k_thread, create, new_thread);
 
 	return stack_ptr;
@@ -758,6 +763,7 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 
 #ifdef CONFIG_SMP
 	thread_base->is_idle = 0;
+	thread_base->cpu = 0;
 #endif /* CONFIG_SMP */
 
 #ifdef CONFIG_TIMESLICE_PER_THREAD
@@ -924,6 +930,10 @@ void z_thread_mark_switched_in(void)
 	z_sched_usage_start(_current);
 #endif /* CONFIG_SCHED_THREAD_USAGE && !CONFIG_USE_SWITCH */
 
+#if defined(CONFIG_SCHED_LATENCY_STATS) && !defined(CONFIG_USE_SWITCH)
+	z_sched_latency_switch(_current);
+#endif /* CONFIG_SCHED_LATENCY_STATS && !CONFIG_USE_SWITCH */
+
 #ifdef CONFIG_TRACING
 	SYS_PORT_TRACING_FUNC(k_thread, switched_in);
 #endif /* CONFIG_TRACING */
@@ -994,6 +1004,10 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	z_sched_latency_all(&stats->latency);
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 	return 0;
 }
 
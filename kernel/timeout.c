@@ -8,22 +8,15 @@
 #include <zephyr/spinlock.h>
 #include <ksched.h>
 #include <timeout_q.h>
+#include <ipi.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
-
-static uint64_t curr_tick;
-
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
-static struct k_spinlock timeout_lock;
+#include <zephyr/sys/math_extras.h>
 
 #define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
 		  ? K_TICKS_FOREVER : INT_MAX)
 
-/* Ticks left to process in the currently-executing sys_clock_announce() */
-static int announce_remaining;
-
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 
@@ -36,34 +29,432 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
-static struct _timeout *first(void)
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+#define WHEEL_BITS   CONFIG_TIMEOUT_WHEEL_SLOT_BITS
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+#define WHEEL_WORDS  (WHEEL_SLOTS / 32)
+
+/* Shifts by WHEEL_BITS * WHEEL_LEVELS must stay defined on 64 bit ticks */
+BUILD_ASSERT((WHEEL_BITS * WHEEL_LEVELS) < 64,
+	     "timing wheel spans more than 64 bits of ticks");
+
+/* Hierarchical timing wheel.  A timeout lives in the lowest level
+ * whose current revolution contains its expiry, i.e. at the level of
+ * the highest WHEEL_BITS wide digit in which its expiry differs from
+ * the wheel's base tick, and in the slot indexed by that digit.  All
+ * entries of a level 0 slot therefore expire on the same tick, in
+ * FIFO order.  When the base tick moves into a new slot of a higher
+ * level, the entries of that slot are cascaded to the lower levels.
+ *
+ * Wheel ticks run independently of the queue tick (which tests may
+ * set directly), they only ever advance through elapse().  Slot lists
+ * are only valid while their bit is set in the occupancy bitmap, so
+ * nothing needs to be initialized at boot.
+ */
+struct timeout_wheel {
+	uint64_t base;
+	uint32_t occupied[WHEEL_LEVELS][WHEEL_WORDS];
+	sys_dlist_t slots[WHEEL_LEVELS][WHEEL_SLOTS];
+	sys_dlist_t overflow;
+
+	/* Cached result of first(), valid if first_valid */
+	struct _timeout *first;
+	bool first_valid;
+};
+
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+/* A queue of pending timeouts.  There is a single one unless
+ * CONFIG_TIMEOUT_PER_CPU is enabled, in which case each CPU queues
+ * the timeouts it arms on its own queue and expires them itself.
+ */
+struct timeout_q {
+	struct k_spinlock lock;
+
+	/* Ticks this queue has processed.  While expiring timeouts,
+	 * this is the tick of the timeout being expired.
+	 */
+	uint64_t tick;
+
+	/* Ticks announced to this queue by the timer driver */
+	uint64_t announced;
+
+	/* True while timeouts are being expired */
+	bool announcing;
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	struct timeout_wheel wheel;
+#else
+	sys_dlist_t list;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+};
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+#define NUM_TIMEOUT_QS CONFIG_MP_MAX_NUM_CPUS
+
+/* Protects curr_tick and the programming of the system timer, taken
+ * before any queue lock when both are needed.
+ */
+static struct k_spinlock timeout_lock;
+
+/* Ticks announced by the timer driver */
+static uint64_t curr_tick;
+#else
+#define NUM_TIMEOUT_QS 1
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+#define TIMEOUT_Q_INIT(i, _) {						\
+	.wheel = {							\
+		.overflow = SYS_DLIST_STATIC_INIT(&timeout_qs[i].wheel.overflow), \
+		.first_valid = true,					\
+	},								\
+}
+#else
+#define TIMEOUT_Q_INIT(i, _) {						\
+	.list = SYS_DLIST_STATIC_INIT(&timeout_qs[i].list),		\
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+static struct timeout_q timeout_qs[NUM_TIMEOUT_QS] = {
+	LISTIFY(NUM_TIMEOUT_QS, TIMEOUT_Q_INIT, (,))
+};
+
+/* The timeout queue backends below all provide the same set of
+ * operations, called with the queue lock held:
+ *
+ * first(q):               the pending timeout expiring soonest
+ * timeout_rem(q, t):      ticks until t expires, relative to q->tick
+ * insert_timeout(q, ...): queue a timeout expiring a number of ticks
+ *                         after q->tick
+ * remove_timeout(q, t):   dequeue a pending timeout
+ * elapse(q, ticks):       account for ticks about to be added to
+ *                         q->tick, never more than timeout_rem(first())
+ */
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+static inline unsigned int wheel_slot(uint64_t tick, int lvl)
+{
+	return (tick >> (WHEEL_BITS * lvl)) & WHEEL_MASK;
+}
+
+/* Level for a given expiry, WHEEL_LEVELS meaning the overflow list */
+static int wheel_level(struct timeout_wheel *w, uint64_t expiry)
+{
+	uint64_t diff = expiry ^ w->base;
+	int lvl = 0;
+
+	while ((lvl < WHEEL_LEVELS) && ((diff >> (WHEEL_BITS * (lvl + 1))) != 0)) {
+		lvl++;
+	}
+
+	return lvl;
+}
+
+/* Index of the first occupied slot of a level at or after start, or -1 */
+static int wheel_next_slot(struct timeout_wheel *w, int lvl, unsigned int start)
+{
+	for (unsigned int i = start / 32; i < WHEEL_WORDS; i++) {
+		uint32_t bits = w->occupied[lvl][i];
+
+		if (i == (start / 32)) {
+			bits &= ~BIT_MASK(start % 32);
+		}
+		if (bits != 0) {
+			return (i * 32) + u32_count_trailing_zeros(bits);
+		}
+	}
+
+	return -1;
+}
+
+static void wheel_link(struct timeout_wheel *w, struct _timeout *to)
+{
+	int lvl = wheel_level(w, to->expiry);
+
+	if (lvl == WHEEL_LEVELS) {
+		sys_dlist_append(&w->overflow, &to->node);
+		return;
+	}
+
+	unsigned int slot = wheel_slot(to->expiry, lvl);
+	uint32_t *word = &w->occupied[lvl][slot / 32];
+
+	if ((*word & BIT(slot % 32)) == 0) {
+		sys_dlist_init(&w->slots[lvl][slot]);
+		*word |= BIT(slot % 32);
+	}
+	sys_dlist_append(&w->slots[lvl][slot], &to->node);
+}
+
+/* Re-files all entries of a list, which must not be relinked into it */
+static void wheel_relink(struct timeout_wheel *w, sys_dlist_t *list)
+{
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(list)) != NULL) {
+		wheel_link(w, CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+static struct _timeout *wheel_min(sys_dlist_t *list)
+{
+	struct _timeout *ret = NULL, *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(list, t, node) {
+		if ((ret == NULL) || (t->expiry < ret->expiry)) {
+			ret = t;
+		}
+	}
+
+	return ret;
+}
+
+static struct _timeout *first(struct timeout_q *q)
+{
+	struct timeout_wheel *w = &q->wheel;
+
+	if (w->first_valid) {
+		return w->first;
+	}
+
+	/* Every entry of a level expires before any entry of the
+	 * levels above it, and slots within a level are in expiry
+	 * order from the base tick on.
+	 */
+	w->first = NULL;
+	for (int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+		int slot = wheel_next_slot(w, lvl, wheel_slot(w->base, lvl));
+
+		if (slot >= 0) {
+			w->first = wheel_min(&w->slots[lvl][slot]);
+			break;
+		}
+	}
+	if (w->first == NULL) {
+		w->first = wheel_min(&w->overflow);
+	}
+	w->first_valid = true;
+
+	return w->first;
+}
+
+static k_ticks_t timeout_rem(struct timeout_q *q,
+			     const struct _timeout *timeout)
 {
-	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
+	return timeout->expiry - q->wheel.base;
+}
+
+static void insert_timeout(struct timeout_q *q, struct _timeout *to,
+			   k_ticks_t ticks)
+{
+	struct timeout_wheel *w = &q->wheel;
+
+	to->expiry = w->base + MAX(0, ticks);
+	wheel_link(w, to);
+
+	if (w->first_valid &&
+	    ((w->first == NULL) || (to->expiry < w->first->expiry))) {
+		w->first = to;
+	}
+}
+
+static void remove_timeout(struct timeout_q *q, struct _timeout *t)
+{
+	struct timeout_wheel *w = &q->wheel;
+	int lvl = wheel_level(w, t->expiry);
+
+	sys_dlist_remove(&t->node);
+
+	if (lvl < WHEEL_LEVELS) {
+		unsigned int slot = wheel_slot(t->expiry, lvl);
+
+		if (sys_dlist_is_empty(&w->slots[lvl][slot])) {
+			w->occupied[lvl][slot / 32] &= ~BIT(slot % 32);
+		}
+	}
+
+	if (t == w->first) {
+		w->first_valid = false;
+	}
+}
+
+static void elapse(struct timeout_q *q, k_ticks_t ticks)
+{
+	struct timeout_wheel *w = &q->wheel;
+	uint64_t old = w->base;
+	uint64_t diff;
+
+	w->base += MAX(0, ticks);
+	diff = old ^ w->base;
+
+	/* Nothing can expire before the new base, so the only slots
+	 * that need cascading are the ones the base just moved into,
+	 * highest level first so entries can trickle all the way down.
+	 */
+	if ((diff >> (WHEEL_BITS * WHEEL_LEVELS)) != 0) {
+		sys_dlist_t list;
+		sys_dnode_t *node;
+
+		sys_dlist_init(&list);
+		while ((node = sys_dlist_get(&w->overflow)) != NULL) {
+			sys_dlist_append(&list, node);
+		}
+		wheel_relink(w, &list);
+	}
+
+	for (int lvl = WHEEL_LEVELS - 1; lvl > 0; lvl--) {
+		unsigned int slot = wheel_slot(w->base, lvl);
+		uint32_t *word = &w->occupied[lvl][slot / 32];
+
+		if (((diff >> (WHEEL_BITS * lvl)) != 0) &&
+		    ((*word & BIT(slot % 32)) != 0)) {
+			*word &= ~BIT(slot % 32);
+			wheel_relink(w, &w->slots[lvl][slot]);
+		}
+	}
+}
+
+#else
+
+static struct _timeout *first(struct timeout_q *q)
+{
+	sys_dnode_t *t = sys_dlist_peek_head(&q->list);
 
 	return t == NULL ? NULL : CONTAINER_OF(t, struct _timeout, node);
 }
 
-static struct _timeout *next(struct _timeout *t)
+static struct _timeout *next(struct timeout_q *q, struct _timeout *t)
 {
-	sys_dnode_t *n = sys_dlist_peek_next(&timeout_list, &t->node);
+	sys_dnode_t *n = sys_dlist_peek_next(&q->list, &t->node);
 
 	return n == NULL ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
-static void remove_timeout(struct _timeout *t)
+static k_ticks_t timeout_rem(struct timeout_q *q,
+			     const struct _timeout *timeout)
 {
-	if (next(t) != NULL) {
-		next(t)->dticks += t->dticks;
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(q); t != NULL; t = next(q, t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+static void insert_timeout(struct timeout_q *q, struct _timeout *to,
+			   k_ticks_t ticks)
+{
+	struct _timeout *t;
+
+	to->dticks = ticks;
+
+	for (t = first(q); t != NULL; t = next(q, t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&q->list, &to->node);
+	}
+}
+
+static void remove_timeout(struct timeout_q *q, struct _timeout *t)
+{
+	if (next(q, t) != NULL) {
+		next(q, t)->dticks += t->dticks;
 	}
 
 	sys_dlist_remove(&t->node);
 }
 
-static int32_t elapsed(void)
+static void elapse(struct timeout_q *q, k_ticks_t ticks)
+{
+	struct _timeout *t = first(q);
+
+	if (t != NULL) {
+		t->dticks -= ticks;
+	}
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Ticks until the earliest latest expiry (expiry plus slack) of the
+ * pending timeouts, starting from the first one.  Timeouts are sorted
+ * by expiry, so the walk can stop at the first one expiring after the
+ * earliest latest expiry found so far.
+ */
+static k_ticks_t deadline_rem(struct timeout_q *q, struct _timeout *to)
+{
+	k_ticks_t ticks = to->dticks;
+	k_ticks_t ret = ticks + to->slack;
+
+	for (struct _timeout *t = next(q, to); t != NULL; t = next(q, t)) {
+		ticks += t->dticks;
+		if (ticks >= ret) {
+			break;
+		}
+		ret = MIN(ret, ticks + t->slack);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+/* The queue timeouts armed by the current context go to.  With
+ * CONFIG_TIMEOUT_PER_CPU, must be called with interrupts locked.
+ */
+static inline struct timeout_q *local_q(void)
+{
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	return &timeout_qs[arch_curr_cpu()->id];
+#else
+	return &timeout_qs[0];
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+}
+
+/* Ticks until the system timer must fire for a queue whose first
+ * pending timeout is to
+ */
+static inline k_ticks_t wakeup_rem(struct timeout_q *q, struct _timeout *to)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	return deadline_rem(q, to);
+#else
+	return timeout_rem(q, to);
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
+/* Whether the system timer needs to be reprogrammed for a timeout
+ * just queued
+ */
+static inline bool sets_wakeup(struct timeout_q *q, struct _timeout *to)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	return (timeout_rem(q, to) + to->slack) == deadline_rem(q, first(q));
+#else
+	return to == first(q);
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
+static int32_t elapsed(struct timeout_q *q)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
 	 * scheduled relatively to the currently firing timeout's original tick
-	 * value (=curr_tick) rather than relative to the current
+	 * value (=q->tick) rather than relative to the current
 	 * sys_clock_elapsed().
 	 *
 	 * This means that timeouts being scheduled from within timeout callbacks
@@ -73,31 +464,79 @@ static int32_t elapsed(void)
 	 * As a side effect, the same will happen if an ISR with higher priority
 	 * preempts a timeout callback and schedules a timeout.
 	 *
-	 * The distinction is implemented by looking at announce_remaining which
-	 * will be non-zero while sys_clock_announce() is executing and zero
-	 * otherwise.
+	 * Otherwise, ticks already announced to a queue but not processed by
+	 * it yet (its CPU has not caught up yet with per-CPU queues) have
+	 * elapsed as well.
 	 */
-	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
+	return q->announcing ? 0U
+		: (int32_t)(q->announced - q->tick) + sys_clock_elapsed();
+}
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+
+/* Must be called with timeout_lock held */
+static int32_t next_timeout(void)
+{
+	int64_t ticks = INT64_MAX;
+	int32_t ret;
+
+	for (int i = 0; i < NUM_TIMEOUT_QS; i++) {
+		struct timeout_q *q = &timeout_qs[i];
+
+		K_SPINLOCK(&q->lock) {
+			struct _timeout *to = first(q);
+
+			if (to != NULL) {
+				int64_t dt = q->tick + wakeup_rem(q, to) - curr_tick;
+
+				ticks = MIN(ticks, dt);
+			}
+		}
+	}
+
+	ticks -= sys_clock_elapsed();
+
+	if (ticks > (int64_t)INT_MAX) {
+		ret = MAX_WAIT;
+	} else {
+		ret = MAX(0, ticks);
+	}
+
+	return ret;
 }
 
+static void set_next_timeout(void)
+{
+	K_SPINLOCK(&timeout_lock) {
+		sys_clock_set_timeout(next_timeout(), false);
+	}
+}
+
+#else
+
+/* Must be called with the queue lock held */
 static int32_t next_timeout(void)
 {
-	struct _timeout *to = first();
-	int32_t ticks_elapsed = elapsed();
+	struct timeout_q *q = &timeout_qs[0];
+	struct _timeout *to = first(q);
+	k_ticks_t ticks = (to == NULL) ? 0 : wakeup_rem(q, to);
+	int32_t ticks_elapsed = elapsed(q);
 	int32_t ret;
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((int64_t)(ticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, ticks - ticks_elapsed);
 	}
 
 	return ret;
 }
 
-void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
-		   k_timeout_t timeout)
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
+static void add_timeout(struct _timeout *to, _timeout_func_t fn,
+			k_timeout_t timeout, k_ticks_t slack)
 {
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		return;
@@ -110,90 +549,136 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	__ASSERT(!sys_dnode_is_linked(&to->node), "");
 	to->fn = fn;
 
-	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* Stay on this CPU until the timeout is queued */
+	unsigned int key = arch_irq_lock();
+	bool reprogram = false;
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+	struct timeout_q *q = local_q();
+
+	K_SPINLOCK(&q->lock) {
+		k_ticks_t ticks;
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    Z_TICK_ABS(timeout.ticks) >= 0) {
-			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
-
-			to->dticks = MAX(1, ticks);
+			ticks = MAX(1, Z_TICK_ABS(timeout.ticks) - q->tick);
 		} else {
-			to->dticks = timeout.ticks + 1 + elapsed();
+			ticks = timeout.ticks + 1 + elapsed(q);
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
-
-		if (to == first() && announce_remaining == 0) {
+#ifdef CONFIG_TIMEOUT_PER_CPU
+		to->cpu = q - timeout_qs;
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+#ifdef CONFIG_TIMEOUT_SLACK
+		to->slack = MIN(slack, Z_TICK_SLACK_MAX);
+#endif /* CONFIG_TIMEOUT_SLACK */
+		insert_timeout(q, to, ticks);
+
+		if (!q->announcing && sets_wakeup(q, to)) {
+#ifdef CONFIG_TIMEOUT_PER_CPU
+			reprogram = true;
+#else
 			sys_clock_set_timeout(next_timeout(), false);
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 		}
 	}
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	if (reprogram) {
+		set_next_timeout();
+	}
+	arch_irq_unlock(key);
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 }
 
-int z_abort_timeout(struct _timeout *to)
+void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
+		   k_timeout_t timeout)
 {
-	int ret = -EINVAL;
+	add_timeout(to, fn, Z_TIMEOUT_TICKS(Z_TICK_NO_SLACK(timeout.ticks)),
+		    Z_TICK_SLACK(timeout.ticks));
+}
 
-	K_SPINLOCK(&timeout_lock) {
-		if (sys_dnode_is_linked(&to->node)) {
-			remove_timeout(to);
-			ret = 0;
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_add_timeout_slack(struct _timeout *to, _timeout_func_t fn,
+			 k_timeout_t timeout, k_ticks_t slack)
+{
+	add_timeout(to, fn, timeout, slack);
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+/* Locks the queue a timeout is filed on.  Timeouts only change queues
+ * with both the source and destination queue locks held, so the
+ * queue is stable once its lock is held and still matches.
+ */
+static struct timeout_q *lock_timeout_q(const struct _timeout *to,
+					k_spinlock_key_t *key)
+{
+	while (true) {
+		struct timeout_q *q = &timeout_qs[to->cpu];
+
+		*key = k_spin_lock(&q->lock);
+		if (&timeout_qs[to->cpu] == q) {
+			return q;
 		}
+		k_spin_unlock(&q->lock, *key);
 	}
+}
+#else
+static struct timeout_q *lock_timeout_q(const struct _timeout *to,
+					k_spinlock_key_t *key)
+{
+	ARG_UNUSED(to);
 
-	return ret;
+	*key = k_spin_lock(&timeout_qs[0].lock);
+	return &timeout_qs[0];
 }
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
+int z_abort_timeout(struct _timeout *to)
 {
-	k_ticks_t ticks = 0;
+	int ret = -EINVAL;
+	k_spinlock_key_t key;
+	struct timeout_q *q = lock_timeout_q(to, &key);
 
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
+	if (sys_dnode_is_linked(&to->node)) {
+		remove_timeout(q, to);
+		ret = 0;
 	}
 
-	return ticks;
+	k_spin_unlock(&q->lock, key);
+
+	return ret;
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
+	k_spinlock_key_t key;
+	struct timeout_q *q = lock_timeout_q(timeout, &key);
 
-	K_SPINLOCK(&timeout_lock) {
-		if (!z_is_inactive_timeout(timeout)) {
-			ticks = timeout_rem(timeout) - elapsed();
-		}
+	if (!z_is_inactive_timeout(timeout)) {
+		ticks = timeout_rem(q, timeout) - elapsed(q);
 	}
 
+	k_spin_unlock(&q->lock, key);
+
 	return ticks;
 }
 
 k_ticks_t z_timeout_expires(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
+	k_spinlock_key_t key;
+	struct timeout_q *q = lock_timeout_q(timeout, &key);
 
-	K_SPINLOCK(&timeout_lock) {
-		ticks = curr_tick;
-		if (!z_is_inactive_timeout(timeout)) {
-			ticks += timeout_rem(timeout);
-		}
+	ticks = q->tick;
+	if (!z_is_inactive_timeout(timeout)) {
+		ticks += timeout_rem(q, timeout);
 	}
 
+	k_spin_unlock(&q->lock, key);
+
 	return ticks;
 }
 
@@ -201,70 +686,169 @@ int32_t z_get_next_timeout_expiry(void)
 {
 	int32_t ret = (int32_t) K_TICKS_FOREVER;
 
+#ifdef CONFIG_TIMEOUT_PER_CPU
 	K_SPINLOCK(&timeout_lock) {
+#else
+	K_SPINLOCK(&timeout_qs[0].lock) {
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 		ret = next_timeout();
 	}
 	return ret;
 }
 
-void sys_clock_announce(int32_t ticks)
+/* Expires the due timeouts of a queue, releasing its lock */
+static void announce_q(struct timeout_q *q, k_spinlock_key_t key)
 {
-	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
-
 	/* We release the lock around the callbacks below, so on SMP
-	 * systems someone might be already running the loop.  Don't
-	 * race (which will cause paralllel execution of "sequential"
-	 * timeouts and confuse apps), just increment the tick count
-	 * and return.
+	 * systems (or from a nested interrupt, with per-CPU queues)
+	 * someone might be already running the loop.  Don't race
+	 * (which will cause paralllel execution of "sequential"
+	 * timeouts and confuse apps), the running loop will pick up
+	 * the newly announced ticks.
 	 */
-	if (IS_ENABLED(CONFIG_SMP) && (announce_remaining != 0)) {
-		announce_remaining += ticks;
-		k_spin_unlock(&timeout_lock, key);
+	if (q->announcing) {
+		k_spin_unlock(&q->lock, key);
 		return;
 	}
 
-	announce_remaining = ticks;
+	q->announcing = true;
 
 	struct _timeout *t;
 
-	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
-	     t = first()) {
-		int dt = t->dticks;
+	for (t = first(q);
+	     (t != NULL) && (timeout_rem(q, t) <= (k_ticks_t)(q->announced - q->tick));
+	     t = first(q)) {
+		k_ticks_t dt = timeout_rem(q, t);
 
-		curr_tick += dt;
-		t->dticks = 0;
-		remove_timeout(t);
+		elapse(q, dt);
+		q->tick += dt;
+		remove_timeout(q, t);
 
-		k_spin_unlock(&timeout_lock, key);
+		k_spin_unlock(&q->lock, key);
 		t->fn(t);
-		key = k_spin_lock(&timeout_lock);
-		announce_remaining -= dt;
+		key = k_spin_lock(&q->lock);
 	}
 
-	if (t != NULL) {
-		t->dticks -= announce_remaining;
+	elapse(q, q->announced - q->tick);
+	q->tick = q->announced;
+	q->announcing = false;
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	k_spin_unlock(&q->lock, key);
+	set_next_timeout();
+#else
+	sys_clock_set_timeout(next_timeout(), false);
+
+	k_spin_unlock(&q->lock, key);
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+}
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+
+void sys_clock_announce(int32_t ticks)
+{
+	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+	struct timeout_q *local = local_q();
+
+	curr_tick += ticks;
+
+	/* Hand the ticks to every queue, and have the other CPUs
+	 * expire their own queues if anything is due there.
+	 */
+	for (int i = 0; i < NUM_TIMEOUT_QS; i++) {
+		struct timeout_q *q = &timeout_qs[i];
+
+		K_SPINLOCK(&q->lock) {
+			struct _timeout *t = first(q);
+
+			q->announced = curr_tick;
+			if ((q != local) && (t != NULL) &&
+			    ((q->tick + timeout_rem(q, t)) <= curr_tick)) {
+				flag_ipi(IPI_CPU_MASK(i));
+			}
+		}
 	}
 
-	curr_tick += announce_remaining;
-	announce_remaining = 0;
+	(void)k_spin_lock(&local->lock);
+	k_spin_release(&timeout_lock);
 
-	sys_clock_set_timeout(next_timeout(), false);
+	signal_pending_ipi();
 
-	k_spin_unlock(&timeout_lock, key);
+	announce_q(local, key);
 
 #ifdef CONFIG_TIMESLICING
 	z_time_slice();
 #endif /* CONFIG_TIMESLICING */
 }
 
+/* Called from the scheduler IPI handler */
+void z_timeout_ipi(void)
+{
+	struct timeout_q *q = local_q();
+
+	announce_q(q, k_spin_lock(&q->lock));
+}
+
+void z_move_timeout(struct _timeout *to, int cpu)
+{
+	struct timeout_q *dst = &timeout_qs[cpu];
+	bool reprogram = false;
+
+	while (true) {
+		struct timeout_q *src = &timeout_qs[to->cpu];
+		struct timeout_q *lo = MIN(src, dst), *hi = MAX(src, dst);
+		k_spinlock_key_t key = k_spin_lock(&lo->lock);
+
+		if (hi != lo) {
+			(void)k_spin_lock(&hi->lock);
+		}
+
+		if (&timeout_qs[to->cpu] == src) {
+			if ((src != dst) && sys_dnode_is_linked(&to->node)) {
+				/* Both queue ticks count announced ticks */
+				k_ticks_t ticks = src->tick + timeout_rem(src, to) - dst->tick;
+
+				remove_timeout(src, to);
+				insert_timeout(dst, to, ticks);
+				reprogram = !dst->announcing && sets_wakeup(dst, to);
+			}
+			to->cpu = cpu;
+		}
+
+		if (hi != lo) {
+			k_spin_release(&hi->lock);
+		}
+		k_spin_unlock(&lo->lock, key);
+
+		if (to->cpu == cpu) {
+			break;
+		}
+	}
+
+	if (reprogram) {
+		set_next_timeout();
+	}
+}
+
 int64_t sys_clock_tick_get(void)
 {
 	uint64_t t = 0U;
+	unsigned int cpu_key = arch_irq_lock();
+	struct timeout_q *q = local_q();
 
-	K_SPINLOCK(&timeout_lock) {
-		t = curr_tick + elapsed();
+	/* Only this CPU expires its queue, and it can't be doing it
+	 * with interrupts locked, so no need to take the queue lock.
+	 */
+	if (q->announcing) {
+		t = q->tick;
+	} else {
+		K_SPINLOCK(&timeout_lock) {
+			t = curr_tick + sys_clock_elapsed();
+		}
 	}
+
+	arch_irq_unlock(cpu_key);
+
 	return t;
 }
 
@@ -277,6 +861,43 @@ uint32_t sys_clock_tick_get_32(void)
 #endif /* CONFIG_TICKLESS_KERNEL */
 }
 
+#else
+
+void sys_clock_announce(int32_t ticks)
+{
+	struct timeout_q *q = &timeout_qs[0];
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+
+	q->announced += ticks;
+
+	announce_q(q, key);
+
+#ifdef CONFIG_TIMESLICING
+	z_time_slice();
+#endif /* CONFIG_TIMESLICING */
+}
+
+int64_t sys_clock_tick_get(void)
+{
+	uint64_t t = 0U;
+
+	K_SPINLOCK(&timeout_qs[0].lock) {
+		t = timeout_qs[0].tick + elapsed(&timeout_qs[0]);
+	}
+	return t;
+}
+
+uint32_t sys_clock_tick_get_32(void)
+{
+#ifdef CONFIG_TICKLESS_KERNEL
+	return (uint32_t)sys_clock_tick_get();
+#else
+	return (uint32_t)timeout_qs[0].tick;
+#endif /* CONFIG_TICKLESS_KERNEL */
+}
+
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
 int64_t z_impl_k_uptime_ticks(void)
 {
 	return sys_clock_tick_get();
@@ -299,7 +920,7 @@ k_timepoint_t sys_timepoint_calc(k_timeout_t timeout)
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 		timepoint.tick = 0;
 	} else {
-		k_ticks_t dt = timeout.ticks;
+		k_ticks_t dt = Z_TICK_NO_SLACK(timeout.ticks);
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) && Z_TICK_ABS(dt) >= 0) {
 			timepoint.tick = Z_TICK_ABS(dt);
@@ -330,7 +951,18 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	int64_t delta = tick - curr_tick;
+
 	curr_tick = tick;
+#else
+	int64_t delta = tick - timeout_qs[0].tick;
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
+	for (int i = 0; i < NUM_TIMEOUT_QS; i++) {
+		timeout_qs[i].tick += delta;
+		timeout_qs[i].announced += delta;
+	}
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -55,9 +55,10 @@ void z_timer_expiration_handler(struct _timeout *t)
 	if (!K_TIMEOUT_EQ(timer->period, K_NO_WAIT) &&
 	    !K_TIMEOUT_EQ(timer->period, K_FOREVER)) {
 		k_timeout_t next = timer->period;
+		k_ticks_t slack = Z_TICK_SLACK(next.ticks);
 
 		/* see note about z_add_timeout() in z_impl_k_timer_start() */
-		next.ticks = MAX(next.ticks - 1, 0);
+		next.ticks = MAX(Z_TICK_NO_SLACK(next.ticks) - 1, 0);
 
 #ifdef CONFIG_TIMEOUT_64BIT
 		/* Exploit the fact that uptime during a kernel
@@ -73,8 +74,8 @@ void z_timer_expiration_handler(struct _timeout *t)
 		 */
 		next = K_TIMEOUT_ABS_TICKS(k_uptime_ticks() + 1 + next.ticks);
 #endif /* CONFIG_TIMEOUT_64BIT */
-		z_add_timeout(&timer->timeout, z_timer_expiration_handler,
-			      next);
+		z_add_timeout_slack(&timer->timeout, z_timer_expiration_handler,
+				    next, slack);
 	}
 
 	/* update timer's status */
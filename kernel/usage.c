@@ -118,6 +118,153 @@ void z_sched_usage_stop(void)
 	k_spin_unlock(&usage_lock, k);
 }
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+/* The thread was made ready while it should have preempted the thread
+ * running on the CPU that made it ready, or by an interrupt handler.
+ */
+#define LATENCY_PREEMPT BIT(0)
+#define LATENCY_IRQ     BIT(1)
+
+#define NUM_PRIOS (K_LOWEST_THREAD_PRIO - K_HIGHEST_THREAD_PRIO + 1)
+
+static struct k_sched_latency_stats prio_latency[NUM_PRIOS];
+
+static uint64_t usage_cycles_to_ns(uint32_t cycles)
+{
+#ifdef CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS
+	return timing_cycles_to_ns(cycles);
+#else
+	return k_cyc_to_ns_floor64(cycles);
+#endif /* CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS */
+}
+
+static void latency_hist_add(struct k_sched_latency_hist *hist, uint64_t ns)
+{
+	uint64_t us = ns / NSEC_PER_USEC;
+	unsigned int bucket = (us == 0U) ? 0U : (LOG2(us) + 1U);
+
+	hist->count++;
+	hist->max_ns = MAX(hist->max_ns, (uint32_t)MIN(ns, UINT32_MAX));
+	hist->total_ns += ns;
+	hist->buckets[MIN(bucket, CONFIG_SCHED_LATENCY_STATS_BUCKETS - 1)]++;
+}
+
+static void latency_hist_merge(struct k_sched_latency_hist *dst,
+			       const struct k_sched_latency_hist *src)
+{
+	dst->count += src->count;
+	dst->max_ns = MAX(dst->max_ns, src->max_ns);
+	dst->total_ns += src->total_ns;
+	for (int i = 0; i < CONFIG_SCHED_LATENCY_STATS_BUCKETS; i++) {
+		dst->buckets[i] += src->buckets[i];
+	}
+}
+
+static void latency_add(struct k_sched_latency_stats *stats, uint8_t flags,
+			uint64_t ns)
+{
+	latency_hist_add(&stats->wakeup, ns);
+
+	if ((flags & LATENCY_PREEMPT) != 0U) {
+		latency_hist_add(&stats->preempt, ns);
+	}
+
+	if ((flags & LATENCY_IRQ) != 0U) {
+		latency_hist_add(&stats->irq, ns);
+	}
+}
+
+void z_sched_latency_ready(struct k_thread *thread)
+{
+	struct k_thread *current = _current;
+	uint8_t flags = 0U;
+
+	if (thread == current) {
+		return;
+	}
+
+	if ((current != NULL) && !z_is_idle_thread_object(current) &&
+	    z_is_prio_higher(thread->base.prio, current->base.prio)) {
+		flags |= LATENCY_PREEMPT;
+	}
+
+	if (k_is_in_isr()) {
+		flags |= LATENCY_IRQ;
+	}
+
+	thread->base.latency_flags = flags;
+	thread->base.latency_start = usage_now();
+}
+
+void z_sched_latency_switch(struct k_thread *thread)
+{
+	k_spinlock_key_t key;
+	uint32_t start = thread->base.latency_start;
+	uint64_t ns;
+	int prio;
+
+	if (start == 0U) {
+		return;
+	}
+
+	ns = usage_cycles_to_ns(usage_now() - start);
+	prio = thread->base.prio;
+
+	key = k_spin_lock(&usage_lock);
+
+	thread->base.latency_start = 0U;
+	latency_add(&thread->base.latency, thread->base.latency_flags, ns);
+	if ((prio >= K_HIGHEST_THREAD_PRIO) && (prio <= K_LOWEST_THREAD_PRIO)) {
+		latency_add(&prio_latency[prio - K_HIGHEST_THREAD_PRIO],
+			    thread->base.latency_flags, ns);
+	}
+
+	k_spin_unlock(&usage_lock, key);
+}
+
+void z_sched_latency_all(struct k_sched_latency_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	*stats = (struct k_sched_latency_stats) {};
+
+	key = k_spin_lock(&usage_lock);
+
+	for (int i = 0; i < NUM_PRIOS; i++) {
+		latency_hist_merge(&stats->wakeup, &prio_latency[i].wakeup);
+		latency_hist_merge(&stats->preempt, &prio_latency[i].preempt);
+		latency_hist_merge(&stats->irq, &prio_latency[i].irq);
+	}
+
+	k_spin_unlock(&usage_lock, key);
+}
+
+int k_sched_latency_stats_get(int prio, struct k_sched_latency_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	CHECKIF((prio < K_HIGHEST_THREAD_PRIO) ||
+		(prio > K_LOWEST_THREAD_PRIO) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&usage_lock);
+	*stats = prio_latency[prio - K_HIGHEST_THREAD_PRIO];
+	k_spin_unlock(&usage_lock, key);
+
+	return 0;
+}
+
+void k_sched_latency_stats_reset(void)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&usage_lock);
+	memset(prio_latency, 0, sizeof(prio_latency));
+	k_spin_unlock(&usage_lock, key);
+}
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 {
@@ -222,6 +369,10 @@ void z_sched_thread_usage(struct k_thread *thread,
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 	stats->execution_cycles = thread->base.usage.total;
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	stats->latency = thread->base.latency;
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 	k_spin_unlock(&usage_lock, key);
 }
 
@@ -49,6 +49,7 @@ LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 #ifdef CONFIG_DYNAMIC_OBJECTS
 static struct k_spinlock lists_lock;       /* kobj dlist */
 static struct k_spinlock objfree_lock;     /* k_object_free */
+static struct k_spinlock tree_lock;        /* kobj rbtree, taken last */
 
 #ifdef CONFIG_GEN_PRIV_STACKS
 /* On ARM & ARC MPU we may have two different alignment requirement
@@ -168,6 +169,7 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct k_object kobj;
 	sys_dnode_t dobj_list;
+	struct rbnode node; /* Index by object address */
 
 	/* The object itself */
 	void *data;
@@ -183,9 +185,21 @@ extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
  */
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
+static bool node_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	return (uintptr_t)CONTAINER_OF(a, struct dyn_obj, node)->kobj.name <
+	       (uintptr_t)CONTAINER_OF(b, struct dyn_obj, node)->kobj.name;
+}
+
 /*
- * TODO: Write some hash table code that will replace obj_list.
+ * Red/black tree of allocated kernel objects, sorted by object address,
+ * for looking them up in O(log n) time.  It is protected by its own
+ * lock, so objects can be removed from it by callbacks run with
+ * lists_lock held.
  */
+static struct rbtree obj_rb_tree = {
+	.lessthan_fn = node_lessthan
+};
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -221,31 +235,35 @@ static size_t obj_align_get(enum k_objects otype)
 	return ret;
 }
 
-static struct dyn_obj *dyn_object_find(void *obj)
+/* Must be called with tree_lock held */
+static struct dyn_obj *dyn_object_lookup(void *obj)
 {
-	struct dyn_obj *node;
-	k_spinlock_key_t key;
+	struct rbnode *n = obj_rb_tree.root;
 
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the containing struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
-	key = k_spin_lock(&lists_lock);
+	while (n != NULL) {
+		struct dyn_obj *dyn = CONTAINER_OF(n, struct dyn_obj, node);
 
-	SYS_DLIST_FOR_EACH_CONTAINER(&obj_list, node, dobj_list) {
-		if (node->kobj.name == obj) {
-			goto end;
+		if (dyn->kobj.name == obj) {
+			return dyn;
 		}
+
+		n = z_rb_child(n, ((uintptr_t)obj < (uintptr_t)dyn->kobj.name) ?
+			       0U : 1U);
 	}
 
-	/* No object found */
-	node = NULL;
+	return NULL;
+}
 
- end:
-	k_spin_unlock(&lists_lock, key);
+static struct dyn_obj *dyn_object_find(void *obj)
+{
+	struct dyn_obj *dyn;
+	k_spinlock_key_t key;
 
-	return node;
+	key = k_spin_lock(&tree_lock);
+	dyn = dyn_object_lookup(obj);
+	k_spin_unlock(&tree_lock, key);
+
+	return dyn;
 }
 
 /**
@@ -370,6 +388,9 @@ static struct k_object *dynamic_object_create(enum k_objects otype, size_t align
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
 	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	K_SPINLOCK(&tree_lock) {
+		rb_insert(&obj_rb_tree, &dyn->node);
+	}
 	k_spin_unlock(&lists_lock, key);
 
 	return &dyn->kobj;
@@ -452,7 +473,7 @@ void *z_impl_k_object_alloc_size(enum k_objects otype, size_t size)
 
 void k_object_free(void *obj)
 {
-	struct dyn_obj *dyn;
+	struct dyn_obj *dyn = NULL;
 
 	/* This function is intentionally not exposed to user mode.
 	 * There's currently no robust way to track that an object isn't
@@ -461,7 +482,12 @@ void k_object_free(void *obj)
 
 	k_spinlock_key_t key = k_spin_lock(&objfree_lock);
 
-	dyn = dyn_object_find(obj);
+	K_SPINLOCK(&tree_lock) {
+		dyn = dyn_object_lookup(obj);
+		if (dyn != NULL) {
+			rb_remove(&obj_rb_tree, &dyn->node);
+		}
+	}
 	if (dyn != NULL) {
 		sys_dlist_remove(&dyn->dobj_list);
 
@@ -573,6 +599,9 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 		break;
 	}
 
+	K_SPINLOCK(&tree_lock) {
+		rb_remove(&obj_rb_tree, &dyn->node);
+	}
 	sys_dlist_remove(&dyn->dobj_list);
 	k_free(dyn->data);
 	k_free(dyn);
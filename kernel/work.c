@@ -200,6 +200,9 @@ static void queue_flusher_locked(struct k_work_q *queue,
 	}
 
 	init_flusher(flusher);
+#ifdef CONFIG_WORKQUEUE_POOL
+	flusher->target = work;
+#endif /* CONFIG_WORKQUEUE_POOL */
 	if (in_list) {
 		sys_slist_insert(&queue->pending, &work->node,
 				 &flusher->work.node);
@@ -223,6 +226,35 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 	}
 }
 
+/* Check whether the current thread is one of the queue threads.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to check against.
+ */
+static inline bool queue_is_current_locked(struct k_work_q *queue)
+{
+	if (k_is_in_isr()) {
+		return false;
+	}
+
+	if (_current == &queue->thread) {
+		return true;
+	}
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	struct k_work_q_worker *worker;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (_current == &worker->thread) {
+			return true;
+		}
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	return false;
+}
+
 /* Potentially notify a queue that it needs to look for pending work.
  *
  * This may make the work queue thread ready, but as the lock is held it
@@ -272,7 +304,6 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret = -EBUSY;
-	bool chained = (_current == &queue->thread) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -285,7 +316,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	 */
 	if (!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT)) {
 		ret = -ENODEV;
-	} else if (draining && !chained) {
+	} else if (draining && !queue_is_current_locked(queue)) {
 		ret = -EBUSY;
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
@@ -609,6 +640,47 @@ bool k_work_cancel_sync(struct k_work *work,
 	return pending;
 }
 
+/* Take the next work item that can be run from a queue.
+ *
+ * With several threads animating the queue, an item that is still
+ * running on another thread is left queued so that it doesn't run
+ * concurrently with itself, and so is a flusher for such an item.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to take work from.
+ *
+ * @return the work item, or NULL if none can be run.
+ */
+static struct k_work *queue_take_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	struct k_work *work;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->pending, work, node) {
+		struct k_work *running = work;
+
+		if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+			running = CONTAINER_OF(work, struct z_work_flusher,
+					       work)->target;
+		}
+
+		if (!flag_test(&running->flags, K_WORK_RUNNING_BIT)) {
+			sys_slist_remove(&queue->pending, prev, &work->node);
+			return work;
+		}
+		prev = &work->node;
+	}
+
+	return NULL;
+#else
+	sys_snode_t *node = sys_slist_get(&queue->pending);
+
+	return (node != NULL) ? CONTAINER_OF(node, struct k_work, node) : NULL;
+#endif /* CONFIG_WORKQUEUE_POOL */
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -621,36 +693,29 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
 
 	while (true) {
-		sys_snode_t *node;
-		struct k_work *work = NULL;
+		struct k_work *work;
 		k_work_handler_t handler = NULL;
 		k_spinlock_key_t key = k_spin_lock(&lock);
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
-		if (node != NULL) {
+		work = queue_take_locked(queue);
+		if (work != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
+#ifdef CONFIG_WORKQUEUE_POOL
+			queue->busy++;
+#endif /* CONFIG_WORKQUEUE_POOL */
 			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
-			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
-
-			/* Static code analysis tool can raise a false-positive violation
-			 * in the line below that 'work' is checked for null after being
-			 * dereferenced.
-			 *
-			 * The work is figured out by CONTAINER_OF, as a container
-			 * of type struct k_work that contains the node.
-			 * The only way for it to be NULL is if node would be a member
-			 * of struct k_work object that has been placed at address NULL,
-			 * which should never happen, even line 'if (work != NULL)'
-			 * ensures that.
-			 * This means that if node is not NULL, then work will not be NULL.
-			 */
 			handler = work->handler;
+		} else if (flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT)) {
+			/* Another queue thread is still running an item;
+			 * draining completes when it's done.
+			 */
+			;
 		} else if (flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
@@ -702,7 +767,20 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
+#ifdef CONFIG_WORKQUEUE_POOL
+		/* Items held back while this one ran may be ready now,
+		 * let another thread pick them up.
+		 */
+		if (!sys_slist_is_empty(&queue->pending)) {
+			(void)notify_queue_locked(queue);
+		}
+
+		if (--queue->busy == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+#else
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#endif /* CONFIG_WORKQUEUE_POOL */
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -740,6 +818,10 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
 
 	sys_slist_init(&queue->pending);
+#ifdef CONFIG_WORKQUEUE_POOL
+	sys_slist_init(&queue->workers);
+	queue->busy = 0U;
+#endif /* CONFIG_WORKQUEUE_POOL */
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
 
@@ -747,6 +829,10 @@ void k_work_queue_start(struct k_work_q *queue,
 		flags |= K_WORK_QUEUE_NO_YIELD;
 	}
 
+	if ((cfg != NULL) && cfg->pin_cpus) {
+		flags |= K_WORK_QUEUE_PIN_CPUS;
+	}
+
 	/* It hasn't actually been started yet, but all the state is in place
 	 * so we can submit things and once the thread gets control it's ready
 	 * to roll.
@@ -761,11 +847,56 @@ void k_work_queue_start(struct k_work_q *queue,
 		k_thread_name_set(&queue->thread, cfg->name);
 	}
 
+#ifdef CONFIG_SCHED_CPU_MASK
+	if ((flags & K_WORK_QUEUE_PIN_CPUS) != 0U) {
+		(void)k_thread_cpu_pin(&queue->thread, 0);
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
 	k_thread_start(&queue->thread);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+void k_work_queue_worker_add(struct k_work_q *queue,
+			     struct k_work_q_worker *worker,
+			     k_thread_stack_t *stack,
+			     size_t stack_size)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(worker);
+	__ASSERT_NO_MSG(stack);
+	__ASSERT_NO_MSG(flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	size_t index = sys_slist_len(&queue->workers) + 1U;
+
+	sys_slist_append(&queue->workers, &worker->node);
+	k_spin_unlock(&lock, key);
+
+	(void)k_thread_create(&worker->thread, stack, stack_size,
+			      work_queue_main, queue, NULL, NULL,
+			      k_thread_priority_get(&queue->thread), 0,
+			      K_FOREVER);
+
+#ifdef CONFIG_THREAD_NAME
+	k_thread_name_set(&worker->thread, queue->thread.name);
+#endif /* CONFIG_THREAD_NAME */
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (flag_test(&queue->flags, K_WORK_QUEUE_PIN_CPUS_BIT)) {
+		(void)k_thread_cpu_pin(&worker->thread,
+				       index % arch_num_cpus());
+	}
+#else
+	ARG_UNUSED(index);
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+	k_thread_start(&worker->thread);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
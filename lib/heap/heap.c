@@ -160,12 +160,180 @@ static chunkid_t mem_to_chunkid(struct z_heap *h, void *p)
 	return (mem - chunk_header_bytes(h) - base) / CHUNK_UNIT;
 }
 
+static void free_used_chunk(struct z_heap *h, chunkid_t c)
+{
+	set_chunk_used(h, c, false);
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+
+	free_chunk(h, c);
+}
+
+static void *aligned_alloc_chunk(struct z_heap *h, size_t align, size_t rew,
+				 size_t gap, size_t bytes);
+
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+BUILD_ASSERT(IS_POWER_OF_TWO(SMALL_PAGE_SIZE),
+	     "small object page size must be a power of two");
+BUILD_ASSERT(SMALL_PAGE_SIZE >= 4 * SMALL_MAX_BYTES,
+	     "small object pages too small for the largest size class");
+
+static inline int small_class(size_t bytes)
+{
+	if (bytes <= CHUNK_UNIT) {
+		return 0;
+	}
+
+	return 32 - __builtin_clz(bytes - 1) - 3;
+}
+
+static void page_map_set(struct z_heap *h, struct z_heap_page *page,
+			 bool is_page)
+{
+	size_t f = ((uintptr_t)page - h->page_base) / SMALL_PAGE_SIZE;
+
+	if (is_page) {
+		h->page_map[f / 32U] |= BIT(f % 32U);
+	} else {
+		h->page_map[f / 32U] &= ~BIT(f % 32U);
+	}
+}
+
+static void page_list_add(struct z_heap *h, struct z_heap_page *page)
+{
+	struct z_heap_page **head = &h->pages[page->cls];
+
+	page->prev = NULL;
+	page->next = *head;
+	if (*head != NULL) {
+		(*head)->prev = page;
+	}
+	*head = page;
+}
+
+static void page_list_remove(struct z_heap *h, struct z_heap_page *page)
+{
+	if (page->prev != NULL) {
+		page->prev->next = page->next;
+	} else {
+		h->pages[page->cls] = page->next;
+	}
+	if (page->next != NULL) {
+		page->next->prev = page->prev;
+	}
+}
+
+static struct z_heap_page *page_alloc(struct z_heap *h, int cls)
+{
+	struct z_heap_page *page;
+
+	/* Alignment may need up to twice the page size */
+	if (size_too_big(h, 2 * SMALL_PAGE_SIZE)) {
+		return NULL;
+	}
+
+	page = aligned_alloc_chunk(h, SMALL_PAGE_SIZE, 0,
+				   chunk_header_bytes(h), SMALL_PAGE_SIZE);
+	if (page == NULL) {
+		return NULL;
+	}
+
+	page->free_list = NULL;
+	page->unused = SMALL_PAGE_HDR_BYTES;
+	page->num_used = 0U;
+	page->cls = cls;
+	page_list_add(h, page);
+	page_map_set(h, page, true);
+
+	return page;
+}
+
+static void page_free(struct z_heap *h, struct z_heap_page *page)
+{
+	page_list_remove(h, page);
+	page_map_set(h, page, false);
+	free_used_chunk(h, mem_to_chunkid(h, page));
+}
+
+static void *small_alloc(struct z_heap *h, size_t bytes)
+{
+	int cls = small_class(bytes);
+	struct z_heap_page *page = h->pages[cls];
+	void *mem;
+
+	if (page == NULL) {
+		page = page_alloc(h, cls);
+		if (page == NULL) {
+			return NULL;
+		}
+	}
+
+	if (page->free_list != NULL) {
+		mem = page->free_list;
+		page->free_list = *(void **)mem;
+	} else {
+		mem = (uint8_t *)page + page->unused;
+		page->unused += small_class_bytes(cls);
+	}
+	page->num_used++;
+
+	if (small_page_full(page)) {
+		page_list_remove(h, page);
+	}
+
+	return mem;
+}
+
+static void small_free(struct z_heap *h, struct z_heap_page *page, void *mem)
+{
+	size_t offset = (uint8_t *)mem - (uint8_t *)page;
+	bool was_full = small_page_full(page);
+
+	__ASSERT((offset >= SMALL_PAGE_HDR_BYTES) && (offset < page->unused) &&
+		 ((offset - SMALL_PAGE_HDR_BYTES) %
+		  small_class_bytes(page->cls)) == 0U,
+		 "invalid small object pointer %p", mem);
+	CHECK(page->num_used > 0U);
+
+	*(void **)mem = page->free_list;
+	page->free_list = mem;
+	page->num_used--;
+
+	if (was_full) {
+		page_list_add(h, page);
+	}
+
+	/* Give empty pages back to the heap, but the last one of
+	 * their class to avoid thrashing.
+	 */
+	if ((page->num_used == 0U) &&
+	    ((h->pages[page->cls] != page) || (page->next != NULL))) {
+		page_free(h, page);
+	}
+}
+#endif
+
 void sys_heap_free(struct sys_heap *heap, void *mem)
 {
 	if (mem == NULL) {
 		return; /* ISO C free() semantics */
 	}
 	struct z_heap *h = heap->heap;
+
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+	struct z_heap_page *page = mem_to_page(h, mem);
+
+	if (page != NULL) {
+#ifdef CONFIG_SYS_HEAP_LISTENER
+		heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), mem,
+					  small_class_bytes(page->cls));
+#endif
+		small_free(h, page, mem);
+		return;
+	}
+#endif
+
 	chunkid_t c = mem_to_chunkid(h, mem);
 
 	/*
@@ -184,22 +352,26 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
-#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
-	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
-#endif
-
 #ifdef CONFIG_SYS_HEAP_LISTENER
 	heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), mem,
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
-	free_chunk(h, c);
+	free_used_chunk(h, c);
 }
 
 size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 {
 	struct z_heap *h = heap->heap;
+
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+	struct z_heap_page *page = mem_to_page(h, mem);
+
+	if (page != NULL) {
+		return small_class_bytes(page->cls);
+	}
+#endif
+
 	chunkid_t c = mem_to_chunkid(h, mem);
 	size_t addr = (size_t)mem;
 	size_t chunk_base = (size_t)&chunk_buf(h)[c];
@@ -269,6 +441,21 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 		return NULL;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+	if (bytes <= SMALL_MAX_BYTES) {
+		mem = small_alloc(h, bytes);
+		if (mem != NULL) {
+#ifdef CONFIG_SYS_HEAP_LISTENER
+			heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), mem,
+						   small_class_bytes(small_class(bytes)));
+#endif
+			IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
+			return mem;
+		}
+		/* No page available, try the chunk allocator */
+	}
+#endif
+
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes);
 	chunkid_t c = alloc_chunk(h, chunk_sz);
 	if (c == 0U) {
@@ -298,6 +485,27 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	return mem;
 }
 
+int sys_heap_alloc_n(struct sys_heap *heap, void **mem, size_t count,
+		     size_t bytes)
+{
+	for (size_t i = 0; i < count; i++) {
+		mem[i] = sys_heap_alloc(heap, bytes);
+		if (mem[i] == NULL) {
+			sys_heap_free_n(heap, mem, i);
+			return -ENOMEM;
+		}
+	}
+
+	return 0;
+}
+
+void sys_heap_free_n(struct sys_heap *heap, void **mem, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		sys_heap_free(heap, mem[i]);
+	}
+}
+
 void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
@@ -327,6 +535,26 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 		return NULL;
 	}
 
+	uint8_t *mem = aligned_alloc_chunk(h, align, rew, gap, bytes);
+
+	if (mem == NULL) {
+		return NULL;
+	}
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	chunkid_t c = mem_to_chunkid(h, mem);
+
+	heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), mem,
+				   chunksz_to_bytes(h, chunk_size(h, c)));
+#endif
+
+	IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
+	return mem;
+}
+
+static void *aligned_alloc_chunk(struct z_heap *h, size_t align, size_t rew,
+				 size_t gap, size_t bytes)
+{
 	/*
 	 * Find a free block that is guaranteed to fit.
 	 * We over-allocate to account for alignment and then free
@@ -367,12 +595,6 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	increase_allocated_bytes(h, chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
-#ifdef CONFIG_SYS_HEAP_LISTENER
-	heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), mem,
-				   chunksz_to_bytes(h, chunk_size(h, c)));
-#endif
-
-	IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
 	return mem;
 }
 
@@ -396,6 +618,27 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 		return NULL;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+	struct z_heap_page *page = mem_to_page(h, ptr);
+
+	if (page != NULL) {
+		size_t prev_size = small_class_bytes(page->cls);
+
+		if ((bytes <= prev_size) &&
+		    ((align == 0U) || (((uintptr_t)ptr & (align - 1)) == 0U))) {
+			return ptr;
+		}
+
+		void *ptr2 = sys_heap_aligned_alloc(heap, align, bytes);
+
+		if (ptr2 != NULL) {
+			memcpy(ptr2, ptr, MIN(prev_size, bytes));
+			sys_heap_free(heap, ptr);
+		}
+		return ptr2;
+	}
+#endif
+
 	chunkid_t c = mem_to_chunkid(h, ptr);
 	chunkid_t rc = right_chunk(h, c);
 	size_t align_gap = (uint8_t *)ptr - (uint8_t *)chunk_mem(h, c);
@@ -518,8 +761,24 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 #endif
 
 	int nb_buckets = bucket_idx(h, heap_sz) + 1;
-	chunksz_t chunk0_size = chunksz(sizeof(struct z_heap) +
-				     nb_buckets * sizeof(struct z_heap_bucket));
+	size_t chunk0_bytes = sizeof(struct z_heap) +
+			      nb_buckets * sizeof(struct z_heap_bucket);
+
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+	/* One bit per page-sized frame, appended to the buckets */
+	h->page_base = ROUND_DOWN(addr, SMALL_PAGE_SIZE);
+	size_t nb_frames = (end - h->page_base) / SMALL_PAGE_SIZE + 1;
+	size_t map_words = DIV_ROUND_UP(nb_frames, 32);
+
+	h->page_map = (uint32_t *)&h->buckets[nb_buckets];
+	chunk0_bytes += map_words * sizeof(uint32_t);
+
+	for (int i = 0; i < SMALL_CLASSES; i++) {
+		h->pages[i] = NULL;
+	}
+#endif
+
+	chunksz_t chunk0_size = chunksz(chunk0_bytes);
 
 	__ASSERT(chunk0_size + min_chunk_size(h) <= heap_sz, "heap size is too small");
 
@@ -527,6 +786,12 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+	for (size_t i = 0; i < map_words; i++) {
+		h->page_map[i] = 0U;
+	}
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
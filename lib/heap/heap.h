@@ -65,6 +65,37 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+/* Small objects are carved out of pages, which are regular used
+ * chunks aligned on (and sized to) SMALL_PAGE_SIZE.  A page only
+ * serves objects of a single size class.  Its header lives at the
+ * start of the page, and the objects follow it with no per-object
+ * header at all: a bitmap of the page-sized frames of the heap
+ * tells pages apart from other chunks when memory is freed.
+ *
+ * Objects are handed out from a free list of released objects
+ * linked through their first word, then from the never used space
+ * at the end of the page.  Pages with objects available are linked
+ * into a per-class list, the first page of which serves
+ * allocations.
+ */
+#define SMALL_CLASSES CONFIG_SYS_HEAP_SMALL_OBJECT_CLASSES
+#define SMALL_PAGE_SIZE CONFIG_SYS_HEAP_SMALL_OBJECT_PAGE_SIZE
+#define SMALL_MAX_BYTES (CHUNK_UNIT << (SMALL_CLASSES - 1))
+
+struct z_heap_page {
+	struct z_heap_page *prev;
+	struct z_heap_page *next;
+	void *free_list;
+	uint32_t unused;	/* offset of the never used space */
+	uint16_t num_used;
+	uint16_t cls;
+};
+
+#define SMALL_PAGE_HDR_BYTES \
+	ROUND_UP(sizeof(struct z_heap_page), CHUNK_UNIT)
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +104,11 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+	struct z_heap_page *pages[SMALL_CLASSES];
+	uintptr_t page_base;
+	uint32_t *page_map;
 #endif
 	struct z_heap_bucket buckets[0];
 };
@@ -262,6 +298,33 @@ static inline bool size_too_big(struct z_heap *h, size_t bytes)
 	return (bytes / CHUNK_UNIT) >= h->end_chunk;
 }
 
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+static inline size_t small_class_bytes(int cls)
+{
+	return CHUNK_UNIT << cls;
+}
+
+/* Returns the page holding a small object, or NULL for memory
+ * returned by the chunk allocator.
+ */
+static inline struct z_heap_page *mem_to_page(struct z_heap *h, void *mem)
+{
+	size_t f = ((uintptr_t)mem - h->page_base) / SMALL_PAGE_SIZE;
+
+	if ((h->page_map[f / 32U] & BIT(f % 32U)) == 0U) {
+		return NULL;
+	}
+
+	return (struct z_heap_page *)(h->page_base + f * SMALL_PAGE_SIZE);
+}
+
+static inline bool small_page_full(struct z_heap_page *page)
+{
+	return (page->free_list == NULL) &&
+	       (page->unused + small_class_bytes(page->cls) > SMALL_PAGE_SIZE);
+}
+#endif
+
 static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			   size_t *free_bytes)
 {
@@ -6,6 +6,7 @@
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/kernel.h>
+#include <kernel_internal.h>
 #include "heap.h"
 
 int sys_heap_runtime_stats_get(struct sys_heap *heap,
@@ -19,6 +20,16 @@ int sys_heap_runtime_stats_get(struct sys_heap *heap,
 	stats->allocated_bytes = heap->heap->allocated_bytes;
 	stats->max_allocated_bytes = heap->heap->max_allocated_bytes;
 
+#if defined(CONFIG_HEAP_MEM_POOL_CPU_CACHE) && (K_HEAP_MEM_POOL_SIZE > 0)
+	/* Blocks cached by k_free() are free as far as k_malloc() users
+	 * are concerned.
+	 */
+	size_t cached = z_heap_cpu_cache_bytes(heap);
+
+	stats->free_bytes += cached;
+	stats->allocated_bytes -= cached;
+#endif
+
 	return 0;
 }
 
@@ -6,6 +6,7 @@
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/kernel.h>
+#include <kernel_internal.h>
 #include "heap.h"
 
 /* White-box sys_heap validation code.  Uses internal data structures.
@@ -97,12 +98,42 @@ bool sys_heap_validate(struct sys_heap *heap)
 
 	get_alloc_info(h, &allocated_bytes, &free_bytes);
 	sys_heap_runtime_stats_get(heap, &stat);
+#if defined(CONFIG_HEAP_MEM_POOL_CPU_CACHE) && (K_HEAP_MEM_POOL_SIZE > 0)
+	/* Blocks cached by k_free() are reported as free */
+	size_t cached = z_heap_cpu_cache_bytes(heap);
+
+	stat.allocated_bytes += cached;
+	stat.free_bytes -= cached;
+#endif
 	if ((stat.allocated_bytes != allocated_bytes) ||
 	    (stat.free_bytes != free_bytes)) {
 		return false;
 	}
 #endif
 
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+	/* Pages with objects available must be marked in the page map
+	 * and sit in the list of their size class.
+	 */
+	for (int cls = 0; cls < SMALL_CLASSES; cls++) {
+		struct z_heap_page *prev = NULL;
+
+		for (struct z_heap_page *page = h->pages[cls]; page != NULL;
+		     prev = page, page = page->next) {
+			void *mem = (uint8_t *)page + SMALL_PAGE_HDR_BYTES;
+			chunkid_t pc = ((chunk_unit_t *)page - chunk_buf(h)) - 1;
+
+			VALIDATE(mem_to_page(h, mem) == page);
+			VALIDATE(chunk_used(h, pc));
+			VALIDATE(chunksz_to_bytes(h, chunk_size(h, pc)) >=
+				 SMALL_PAGE_SIZE);
+			VALIDATE(page->cls == cls);
+			VALIDATE(page->prev == prev);
+			VALIDATE(!small_page_full(page));
+		}
+	}
+#endif
+
 	/* Check the free lists: entry count should match, empty bit
 	 * should be correct, and all chunk entries should point into
 	 * valid unused chunks.  Mark those chunks USED, temporarily.
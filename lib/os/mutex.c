@@ -9,6 +9,11 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+#include <ksched.h>
+#include <wait_q.h>
+#endif
+
 static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 {
 	struct k_object *obj;
@@ -23,13 +28,200 @@ static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 
 static bool check_sys_mutex_addr(struct sys_mutex *addr)
 {
-	/* sys_mutex memory is never touched, just used to lookup the
-	 * underlying k_mutex, but we don't want threads using mutexes
-	 * that are outside their memory domain
+	/* Unless CONFIG_SYS_MUTEX_FAST_PATH is enabled, sys_mutex memory
+	 * is never touched, just used to lookup the underlying k_mutex, but
+	 * we don't want threads using mutexes that are outside their memory
+	 * domain
 	 */
 	return K_SYSCALL_MEMORY_WRITE(addr, sizeof(struct sys_mutex));
 }
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/* The backing k_mutex of a fast sys_mutex is only used for its wait
+ * queue, and to remember the owner and its original priority while
+ * threads wait on it.  This lock protects those, and serializes the
+ * updates of sys_mutex::val done on behalf of waiters.
+ */
+static struct k_spinlock lock;
+
+static struct k_thread *owner_thread(atomic_val_t val)
+{
+	struct k_object *obj;
+
+	/* val lives in user memory, any thread able to write the mutex
+	 * may have put any value there: only trust it to name a thread
+	 * the caller could change the priority of anyway, otherwise
+	 * priority inheritance would let it boost any thread.
+	 */
+	obj = k_object_find((void *)(val & ~SYS_MUTEX_CONTENDED));
+	if (obj == NULL) {
+		return NULL;
+	}
+
+	if ((_current->base.user_options & K_USER) != 0U) {
+		if (k_object_validate(obj, K_OBJ_THREAD, _OBJ_INIT_TRUE) != 0) {
+			return NULL;
+		}
+	} else if (obj->type != K_OBJ_THREAD ||
+		   (obj->flags & K_OBJ_FLAG_INITIALIZED) == 0U) {
+		return NULL;
+	}
+
+	return obj->name;
+}
+
+static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
+{
+	int new_prio = z_is_prio_higher(target, limit) ? target : limit;
+
+	return z_get_new_prio_with_ceiling(new_prio);
+}
+
+static bool adjust_owner_prio(struct k_mutex *kernel_mutex, int32_t new_prio)
+{
+	if (kernel_mutex->owner->base.prio != new_prio) {
+		return z_thread_prio_set(kernel_mutex->owner, new_prio);
+	}
+	return false;
+}
+
+static int fast_mutex_lock(struct sys_mutex *mutex,
+			   struct k_mutex *kernel_mutex, k_timeout_t timeout)
+{
+	atomic_val_t val, new_val;
+	k_spinlock_key_t key;
+	bool resched = false;
+	int32_t new_prio;
+	int ret;
+
+	key = k_spin_lock(&lock);
+
+	/* Either take the mutex, or flag it as contended so that its
+	 * owner has to come through fast_mutex_unlock() to release it.
+	 */
+	for (;;) {
+		val = atomic_get(&mutex->val);
+		if ((val & ~SYS_MUTEX_CONTENDED) == 0) {
+			new_val = (atomic_val_t)_current;
+			if (z_waitq_head(&kernel_mutex->wait_q) != NULL) {
+				new_val |= SYS_MUTEX_CONTENDED;
+			}
+			if (atomic_cas(&mutex->val, val, new_val)) {
+				k_spin_unlock(&lock, key);
+				return 0;
+			}
+			continue;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EBUSY;
+		}
+
+		if ((val & SYS_MUTEX_CONTENDED) != 0 ||
+		    atomic_cas(&mutex->val, val, val | SYS_MUTEX_CONTENDED)) {
+			break;
+		}
+	}
+
+	if (z_waitq_head(&kernel_mutex->wait_q) == NULL) {
+		/* First waiter: the mutex was locked from the fast path,
+		 * record its owner for priority inheritance.
+		 */
+		kernel_mutex->owner = owner_thread(val);
+		if (kernel_mutex->owner != NULL) {
+			kernel_mutex->owner_orig_prio =
+				kernel_mutex->owner->base.prio;
+		}
+	}
+
+	if (kernel_mutex->owner != NULL) {
+		new_prio = new_prio_for_inheritance(_current->base.prio,
+						    kernel_mutex->owner->base.prio);
+		if (z_is_prio_higher(new_prio, kernel_mutex->owner->base.prio)) {
+			resched = adjust_owner_prio(kernel_mutex, new_prio);
+		}
+	}
+
+	ret = z_pend_curr(&lock, key, &kernel_mutex->wait_q, timeout);
+	if (ret == 0) {
+		/* Handed over by fast_mutex_unlock() */
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (kernel_mutex->owner != NULL) {
+		struct k_thread *waiter = z_waitq_head(&kernel_mutex->wait_q);
+
+		new_prio = (waiter != NULL) ?
+			new_prio_for_inheritance(waiter->base.prio,
+						 kernel_mutex->owner_orig_prio) :
+			kernel_mutex->owner_orig_prio;
+
+		resched = adjust_owner_prio(kernel_mutex, new_prio) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+static int fast_mutex_unlock(struct sys_mutex *mutex,
+			     struct k_mutex *kernel_mutex)
+{
+	atomic_val_t val;
+	struct k_thread *new_owner;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+
+	val = atomic_get(&mutex->val);
+	if (val == 0) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	if ((val & ~SYS_MUTEX_CONTENDED) != (atomic_val_t)_current) {
+		k_spin_unlock(&lock, key);
+		return -EPERM;
+	}
+
+	if (kernel_mutex->owner == _current) {
+		adjust_owner_prio(kernel_mutex, kernel_mutex->owner_orig_prio);
+	}
+
+	new_owner = z_unpend_first_thread(&kernel_mutex->wait_q);
+	kernel_mutex->owner = new_owner;
+
+	if (new_owner == NULL) {
+		atomic_clear(&mutex->val);
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	/* Hand the mutex over to the first waiter, which keeps it flagged
+	 * as contended if others are still waiting.
+	 */
+	val = (atomic_val_t)new_owner;
+	if (z_waitq_head(&kernel_mutex->wait_q) != NULL) {
+		val |= SYS_MUTEX_CONTENDED;
+	}
+	atomic_set(&mutex->val, val);
+
+	kernel_mutex->owner_orig_prio = new_owner->base.prio;
+	arch_thread_return_value_set(new_owner, 0);
+	z_ready_thread(new_owner);
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
 int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
@@ -38,7 +230,11 @@ int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	return fast_mutex_lock(mutex, kernel_mutex, timeout);
+#else
 	return k_mutex_lock(kernel_mutex, timeout);
+#endif
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
@@ -56,11 +252,19 @@ int z_impl_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	if (kernel_mutex == NULL) {
+		return -EINVAL;
+	}
+
+	return fast_mutex_unlock(mutex, kernel_mutex);
+#else
 	if (kernel_mutex == NULL || kernel_mutex->lock_count == 0) {
 		return -EINVAL;
 	}
 
 	return k_mutex_unlock(kernel_mutex);
+#endif
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
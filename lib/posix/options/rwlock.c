@@ -12,13 +12,8 @@
 #include <zephyr/posix/pthread.h>
 #include <zephyr/sys/bitarray.h>
 
-#define CONCURRENT_READER_LIMIT  (CONFIG_MAX_PTHREAD_COUNT + 1)
-
 struct posix_rwlock {
-	struct k_sem rd_sem;
-	struct k_sem wr_sem;
-	struct k_sem reader_active; /* blocks WR till reader has acquired lock */
-	k_tid_t wr_owner;
+	struct k_rwlock rwlock;
 };
 
 struct posix_rwlockattr {
@@ -27,8 +22,6 @@ struct posix_rwlockattr {
 };
 
 int64_t timespec_to_timeoutms(const struct timespec *abstime);
-static uint32_t read_lock_acquire(struct posix_rwlock *rwl, int32_t timeout);
-static uint32_t write_lock_acquire(struct posix_rwlock *rwl, int32_t timeout);
 
 LOG_MODULE_REGISTER(pthread_rwlock, CONFIG_PTHREAD_RWLOCK_LOG_LEVEL);
 
@@ -105,6 +98,16 @@ struct posix_rwlock *to_posix_rwlock(pthread_rwlock_t *rwlock)
 	return rwl;
 }
 
+static int timed_lock_ret(int ret)
+{
+	/* An absolute time already in the past is a timeout as well */
+	if ((ret == -EBUSY) || (ret == -EAGAIN)) {
+		return ETIMEDOUT;
+	}
+
+	return -ret;
+}
+
 /**
  * @brief Initialize read-write lock object.
  *
@@ -123,10 +126,8 @@ int pthread_rwlock_init(pthread_rwlock_t *rwlock,
 		return ENOMEM;
 	}
 
-	k_sem_init(&rwl->rd_sem, CONCURRENT_READER_LIMIT, CONCURRENT_READER_LIMIT);
-	k_sem_init(&rwl->wr_sem, 1, 1);
-	k_sem_init(&rwl->reader_active, 1, 1);
-	rwl->wr_owner = NULL;
+	/* Keep waiting writers from being starved by new readers */
+	(void)k_rwlock_init(&rwl->rwlock, K_RWLOCK_PREFER_WRITER);
 
 	LOG_DBG("Initialized rwlock %p", rwl);
 
@@ -151,7 +152,7 @@ int pthread_rwlock_destroy(pthread_rwlock_t *rwlock)
 	}
 
 	K_SPINLOCK(&posix_rwlock_spinlock) {
-		if (rwl->wr_owner != NULL) {
+		if ((rwl->rwlock.owner != NULL) || (rwl->rwlock.readers != 0U)) {
 			ret = EBUSY;
 			K_SPINLOCK_BREAK;
 		}
@@ -167,8 +168,7 @@ int pthread_rwlock_destroy(pthread_rwlock_t *rwlock)
 /**
  * @brief Lock a read-write lock object for reading.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
+ * Readers wait while a writer is waiting for the lock.
  *
  * See IEEE 1003.1
  */
@@ -181,14 +181,13 @@ int pthread_rwlock_rdlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	return read_lock_acquire(rwl, SYS_FOREVER_MS);
+	return -k_rwlock_read_lock(&rwl->rwlock, K_FOREVER);
 }
 
 /**
  * @brief Lock a read-write lock object for reading within specific time.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
+ * Readers wait while a writer is waiting for the lock.
  *
  * See IEEE 1003.1
  */
@@ -196,7 +195,6 @@ int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock,
 			       const struct timespec *abstime)
 {
 	int32_t timeout;
-	uint32_t ret = 0U;
 	struct posix_rwlock *rwl;
 
 	if (abstime->tv_nsec < 0 || abstime->tv_nsec > NSEC_PER_SEC) {
@@ -210,18 +208,14 @@ int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock,
 		return EINVAL;
 	}
 
-	if (read_lock_acquire(rwl, timeout) != 0U) {
-		ret = ETIMEDOUT;
-	}
-
-	return ret;
+	return timed_lock_ret(k_rwlock_read_lock(&rwl->rwlock,
+						 SYS_TIMEOUT_MS(timeout)));
 }
 
 /**
  * @brief Lock a read-write lock object for reading immediately.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
+ * Fails while a writer owns or is waiting for the lock.
  *
  * See IEEE 1003.1
  */
@@ -234,14 +228,14 @@ int pthread_rwlock_tryrdlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	return read_lock_acquire(rwl, 0);
+	return -k_rwlock_read_lock(&rwl->rwlock, K_NO_WAIT);
 }
 
 /**
  * @brief Lock a read-write lock object for writing.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Write lock has priority over reader lock, and the writer owning the
+ * lock inherits the priority of the threads waiting for it.
  *
  * See IEEE 1003.1
  */
@@ -254,14 +248,14 @@ int pthread_rwlock_wrlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	return write_lock_acquire(rwl, SYS_FOREVER_MS);
+	return -k_rwlock_write_lock(&rwl->rwlock, K_FOREVER);
 }
 
 /**
  * @brief Lock a read-write lock object for writing within specific time.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Write lock has priority over reader lock, and the writer owning the
+ * lock inherits the priority of the threads waiting for it.
  *
  * See IEEE 1003.1
  */
@@ -269,7 +263,6 @@ int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock,
 			       const struct timespec *abstime)
 {
 	int32_t timeout;
-	uint32_t ret = 0U;
 	struct posix_rwlock *rwl;
 
 	if (abstime->tv_nsec < 0 || abstime->tv_nsec > NSEC_PER_SEC) {
@@ -283,18 +276,15 @@ int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock,
 		return EINVAL;
 	}
 
-	if (write_lock_acquire(rwl, timeout) != 0U) {
-		ret = ETIMEDOUT;
-	}
-
-	return ret;
+	return timed_lock_ret(k_rwlock_write_lock(&rwl->rwlock,
+						  SYS_TIMEOUT_MS(timeout)));
 }
 
 /**
  * @brief Lock a read-write lock object for writing immediately.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Write lock has priority over reader lock, and the writer owning the
+ * lock inherits the priority of the threads waiting for it.
  *
  * See IEEE 1003.1
  */
@@ -307,7 +297,7 @@ int pthread_rwlock_trywrlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	return write_lock_acquire(rwl, 0);
+	return -k_rwlock_write_lock(&rwl->rwlock, K_NO_WAIT);
 }
 
 /**
@@ -325,69 +315,16 @@ int pthread_rwlock_unlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	if (k_current_get() == rwl->wr_owner) {
-		/* Write unlock */
-		rwl->wr_owner = NULL;
-		k_sem_give(&rwl->reader_active);
-		k_sem_give(&rwl->wr_sem);
-	} else {
-		/* Read unlock */
-		k_sem_give(&rwl->rd_sem);
-
-		if (k_sem_count_get(&rwl->rd_sem) == CONCURRENT_READER_LIMIT) {
-			/* Last read lock, unlock writer */
-			k_sem_give(&rwl->reader_active);
-		}
+	if (k_current_get() == rwl->rwlock.owner) {
+		return -k_rwlock_write_unlock(&rwl->rwlock);
 	}
-	return 0;
-}
 
-static uint32_t read_lock_acquire(struct posix_rwlock *rwl, int32_t timeout)
-{
-	uint32_t ret = 0U;
-
-	if (k_sem_take(&rwl->wr_sem, SYS_TIMEOUT_MS(timeout)) == 0) {
-		k_sem_take(&rwl->reader_active, K_NO_WAIT);
-		k_sem_take(&rwl->rd_sem, K_NO_WAIT);
-		k_sem_give(&rwl->wr_sem);
-	} else {
-		ret = EBUSY;
+	if (k_rwlock_read_unlock(&rwl->rwlock) != 0) {
+		/* Not locked at all */
+		return EPERM;
 	}
 
-	return ret;
-}
-
-static uint32_t write_lock_acquire(struct posix_rwlock *rwl, int32_t timeout)
-{
-	uint32_t ret = 0U;
-	int64_t elapsed_time, st_time = k_uptime_get();
-	k_timeout_t k_timeout;
-
-	k_timeout = SYS_TIMEOUT_MS(timeout);
-
-	/* waiting for release of write lock */
-	if (k_sem_take(&rwl->wr_sem, k_timeout) == 0) {
-		/* update remaining timeout time for 2nd sem */
-		if (timeout != SYS_FOREVER_MS) {
-			elapsed_time = k_uptime_get() - st_time;
-			timeout = timeout <= elapsed_time ? 0 :
-				  timeout - elapsed_time;
-		}
-
-		k_timeout = SYS_TIMEOUT_MS(timeout);
-
-		/* waiting for reader to complete operation */
-		if (k_sem_take(&rwl->reader_active, k_timeout) == 0) {
-			rwl->wr_owner = k_current_get();
-		} else {
-			k_sem_give(&rwl->wr_sem);
-			ret = EBUSY;
-		}
-
-	} else {
-		ret = EBUSY;
-	}
-	return ret;
+	return 0;
 }
 
 int pthread_rwlockattr_getpshared(const pthread_rwlockattr_t *ZRESTRICT attr,
@@ -107,7 +107,9 @@ kobjects = OrderedDict([
     ("sys_mutex", (None, True, False)),
     ("k_futex", (None, True, False)),
     ("k_condvar", (None, False, True)),
+    ("k_rwlock", (None, False, True)),
     ("k_event", ("CONFIG_EVENTS", False, True)),
+    ("k_poll_set", ("CONFIG_POLL_SET", False, False)),
     ("ztest_suite_node", ("CONFIG_ZTEST", True, False)),
     ("ztest_suite_stats", ("CONFIG_ZTEST", True, False)),
     ("ztest_unit_test", ("CONFIG_ZTEST", True, False)),
@@ -0,0 +1,436 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Compressed RAM backing store implementation
+ */
+#include <mmu.h>
+#include <string.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/sys_heap.h>
+
+/*
+ * Like the RAM backing store, this keeps evicted data pages in RAM the
+ * kernel is otherwise unaware of, and frees their location as soon as they
+ * are paged back in. But data pages are compressed on page-out and stored
+ * in a pool, where they take less room than as is:
+ *
+ * - Data pages filled with a single repeated word, zeroed pages in
+ *   particular, are stored as that word and take no room in the pool.
+ *
+ * - Other data pages are compressed with a byte oriented LZ77 compressor
+ *   in the spirit of LZ4, and stored in a block of the exact compressed
+ *   size allocated from the pool. The pool is a sys_heap, so blocks are
+ *   served from size classes.
+ *
+ * - Data pages that don't compress are stored as is.
+ *
+ * A location is an index into an array of slots, one per data page the
+ * backing store can hold, times the page size. Since the kernel doesn't
+ * expect page-outs to fail, a location is only handed out along with a
+ * whole page of the pool, which is shrunk down to the compressed size on
+ * page-out.
+ *
+ * Page faults must not fail either, even though a data page paged back in
+ * may be replaced by one that doesn't compress, over and over until every
+ * data page in the backing store is stored as is. So locations are only
+ * handed out outside of page faults while the pool could still hold every
+ * data page in the backing store as is, plus the one a page fault pages out
+ * before freeing the location of the data page it pages in.
+ */
+
+/* Compressed data format, a sequence of:
+ *
+ * - a token byte, holding the number of literals in its upper nibble and
+ *   the match length minus MIN_MATCH in its lower one. A nibble of 15
+ *   is followed by bytes to add to it, up to and including the first one
+ *   lower than 255.
+ * - the literals
+ * - the match offset, as a 16 bit little endian value. The last
+ *   sequence has no match and ends after its literals.
+ */
+#define MIN_MATCH	4U
+#define HASH_BITS	10U
+#define NIBBLE_MAX	15U
+
+BUILD_ASSERT(CONFIG_MMU_PAGE_SIZE <= UINT16_MAX,
+	     "match offsets and hash table entries are 16 bits");
+
+struct slot {
+	sys_snode_t node;
+	/* Compressed data page, NULL if it is made of fill repeated */
+	void *data;
+	/* Size of data, CONFIG_MMU_PAGE_SIZE when stored as is */
+	size_t size;
+	uintptr_t fill;
+	/* Whether a data page has been paged out to this slot */
+	bool stored;
+};
+
+static struct slot slots[CONFIG_BACKING_STORE_COMPRESSED_PAGES];
+static sys_slist_t free_slots;
+static unsigned int free_slots_count;
+
+static char pool_mem[CONFIG_BACKING_STORE_COMPRESSED_POOL_SIZE] __aligned(8);
+static struct sys_heap pool;
+/* Number of data pages the pool can hold as is */
+static unsigned int pool_pages;
+
+/* Compression work areas. Page-ins and page-outs are serialized, so
+ * these don't need to live on the stack.
+ */
+static uint8_t compress_buf[CONFIG_MMU_PAGE_SIZE];
+static uint16_t hash_table[1U << HASH_BITS];
+
+static struct k_mem_paging_backing_store_compressed_stats stats;
+
+static struct slot *location_to_slot(uintptr_t location)
+{
+	__ASSERT(location % CONFIG_MMU_PAGE_SIZE == 0,
+		 "unaligned location 0x%lx", location);
+	__ASSERT(location <
+		 (CONFIG_BACKING_STORE_COMPRESSED_PAGES * CONFIG_MMU_PAGE_SIZE),
+		 "bad location 0x%lx, past bounds of backing store", location);
+
+	return &slots[location / CONFIG_MMU_PAGE_SIZE];
+}
+
+static uintptr_t slot_to_location(struct slot *slot)
+{
+	return (slot - slots) * CONFIG_MMU_PAGE_SIZE;
+}
+
+static inline uint32_t hash(uint32_t seq)
+{
+	return (seq * 2654435761U) >> (32U - HASH_BITS);
+}
+
+/* Appends the extension bytes of a length whose nibble is saturated */
+static uint8_t *put_length(uint8_t *op, uint8_t *op_end, size_t len)
+{
+	for (len -= NIBBLE_MAX; len >= 255U; len -= 255U) {
+		if (op == op_end) {
+			return NULL;
+		}
+		*op++ = 255U;
+	}
+	if (op == op_end) {
+		return NULL;
+	}
+	*op++ = (uint8_t)len;
+
+	return op;
+}
+
+/* Appends a sequence, returning NULL if it doesn't fit before op_end */
+static uint8_t *put_sequence(uint8_t *op, uint8_t *op_end,
+			     const uint8_t *lit, size_t lit_len,
+			     size_t offset, size_t match_len)
+{
+	uint8_t *token = op++;
+	size_t match_code = (match_len != 0U) ? (match_len - MIN_MATCH) : 0U;
+
+	if (token >= op_end) {
+		return NULL;
+	}
+
+	*token = (uint8_t)((MIN(lit_len, NIBBLE_MAX) << 4) |
+			   MIN(match_code, NIBBLE_MAX));
+
+	if (lit_len >= NIBBLE_MAX) {
+		op = put_length(op, op_end, lit_len);
+		if (op == NULL) {
+			return NULL;
+		}
+	}
+
+	if ((size_t)(op_end - op) < lit_len) {
+		return NULL;
+	}
+	(void)memcpy(op, lit, lit_len);
+	op += lit_len;
+
+	if (match_len == 0U) {
+		return op;
+	}
+
+	if ((op_end - op) < 2) {
+		return NULL;
+	}
+	sys_put_le16((uint16_t)offset, op);
+	op += 2;
+
+	if (match_code >= NIBBLE_MAX) {
+		op = put_length(op, op_end, match_code);
+	}
+
+	return op;
+}
+
+/* Returns the compressed size, or 0 if it wouldn't be smaller than the
+ * data page
+ */
+static size_t compress(const uint8_t *src, uint8_t *dst)
+{
+	uint8_t *op = dst, *op_end = dst + CONFIG_MMU_PAGE_SIZE;
+	size_t ip = 0, anchor = 0;
+
+	(void)memset(hash_table, 0, sizeof(hash_table));
+
+	while (ip + MIN_MATCH <= CONFIG_MMU_PAGE_SIZE) {
+		uint32_t seq = sys_get_le32(&src[ip]);
+		uint32_t h = hash(seq);
+		size_t ref = hash_table[h];
+		size_t len = MIN_MATCH;
+
+		hash_table[h] = (uint16_t)ip;
+
+		if ((ref >= ip) || (sys_get_le32(&src[ref]) != seq)) {
+			ip++;
+			continue;
+		}
+
+		while ((ip + len < CONFIG_MMU_PAGE_SIZE) &&
+		       (src[ref + len] == src[ip + len])) {
+			len++;
+		}
+
+		op = put_sequence(op, op_end, &src[anchor], ip - anchor,
+				  ip - ref, len);
+		if (op == NULL) {
+			return 0;
+		}
+
+		ip += len;
+		anchor = ip;
+	}
+
+	op = put_sequence(op, op_end, &src[anchor],
+			  CONFIG_MMU_PAGE_SIZE - anchor, 0, 0);
+	if ((op == NULL) || (op == op_end)) {
+		return 0;
+	}
+
+	return op - dst;
+}
+
+static size_t get_length(const uint8_t **ip, size_t len)
+{
+	uint8_t byte;
+
+	if (len == NIBBLE_MAX) {
+		do {
+			byte = *(*ip)++;
+			len += byte;
+		} while (byte == 255U);
+	}
+
+	return len;
+}
+
+static void decompress(const uint8_t *src, size_t size, uint8_t *dst)
+{
+	const uint8_t *ip = src, *ip_end = src + size;
+	uint8_t *op = dst;
+
+	while (ip < ip_end) {
+		uint8_t token = *ip++;
+		size_t lit_len = get_length(&ip, token >> 4);
+		size_t match_len;
+		const uint8_t *ref;
+
+		__ASSERT(op + lit_len <= dst + CONFIG_MMU_PAGE_SIZE,
+			 "corrupted compressed data page");
+		(void)memcpy(op, ip, lit_len);
+		ip += lit_len;
+		op += lit_len;
+
+		if (ip == ip_end) {
+			break;
+		}
+
+		ref = op - sys_get_le16(ip);
+		ip += 2;
+		match_len = get_length(&ip, token & NIBBLE_MAX) + MIN_MATCH;
+
+		__ASSERT(ref >= dst && op + match_len <= dst + CONFIG_MMU_PAGE_SIZE,
+			 "corrupted compressed data page");
+
+		/* Matches may overlap the data they produce */
+		while (match_len-- > 0U) {
+			*op++ = *ref++;
+		}
+	}
+
+	__ASSERT(op == dst + CONFIG_MMU_PAGE_SIZE,
+		 "compressed data page decompressed to %zu bytes",
+		 (size_t)(op - dst));
+}
+
+static bool page_fill_get(const uintptr_t *page, uintptr_t *fill)
+{
+	for (size_t i = 1; i < CONFIG_MMU_PAGE_SIZE / sizeof(uintptr_t); i++) {
+		if (page[i] != page[0]) {
+			return false;
+		}
+	}
+	*fill = page[0];
+
+	return true;
+}
+
+int k_mem_paging_backing_store_location_get(struct z_page_frame *pf,
+					    uintptr_t *location,
+					    bool page_fault)
+{
+	unsigned int used = ARRAY_SIZE(slots) - free_slots_count;
+	struct slot *slot;
+	void *data;
+
+	if (free_slots_count == 0) {
+		return -ENOMEM;
+	}
+
+	if (!page_fault &&
+	    ((free_slots_count == 1) || ((used + 2U) > pool_pages))) {
+		return -ENOMEM;
+	}
+
+	data = sys_heap_alloc(&pool, CONFIG_MMU_PAGE_SIZE);
+	if (data == NULL) {
+		return -ENOMEM;
+	}
+
+	slot = CONTAINER_OF(sys_slist_get_not_empty(&free_slots),
+			    struct slot, node);
+	free_slots_count--;
+	slot->data = data;
+	slot->size = CONFIG_MMU_PAGE_SIZE;
+	slot->stored = false;
+	*location = slot_to_location(slot);
+
+	return 0;
+}
+
+void k_mem_paging_backing_store_location_free(uintptr_t location)
+{
+	struct slot *slot = location_to_slot(location);
+
+	if (slot->stored) {
+		if (slot->data == NULL) {
+			stats.same_filled--;
+		} else if (slot->size == CONFIG_MMU_PAGE_SIZE) {
+			stats.incompressible--;
+		}
+		stats.pages--;
+		stats.compr_size -= slot->size;
+	}
+
+	sys_heap_free(&pool, slot->data);
+	slot->data = NULL;
+	sys_slist_append(&free_slots, &slot->node);
+	free_slots_count++;
+}
+
+void k_mem_paging_backing_store_page_out(uintptr_t location)
+{
+	struct slot *slot = location_to_slot(location);
+	uint32_t start = k_cycle_get_32();
+	void *data;
+	size_t size;
+
+	if (page_fill_get((uintptr_t *)Z_SCRATCH_PAGE, &slot->fill)) {
+		sys_heap_free(&pool, slot->data);
+		slot->data = NULL;
+		slot->size = 0;
+		stats.same_filled++;
+	} else {
+		size = compress(Z_SCRATCH_PAGE, compress_buf);
+		/* Shrinking in place can't fail for lack of room */
+		data = (size != 0U) ? sys_heap_realloc(&pool, slot->data, size)
+				    : NULL;
+		if (data != NULL) {
+			(void)memcpy(data, compress_buf, size);
+			slot->data = data;
+			slot->size = size;
+		} else {
+			(void)memcpy(slot->data, Z_SCRATCH_PAGE,
+				     CONFIG_MMU_PAGE_SIZE);
+			stats.incompressible++;
+		}
+	}
+
+	slot->stored = true;
+	stats.pages++;
+	stats.compr_size += slot->size;
+	stats.compressions++;
+	stats.compress_cycles += k_cycle_get_32() - start;
+}
+
+void k_mem_paging_backing_store_page_in(uintptr_t location)
+{
+	struct slot *slot = location_to_slot(location);
+	uint32_t start = k_cycle_get_32();
+
+	if (slot->data == NULL) {
+		uintptr_t *page = (uintptr_t *)Z_SCRATCH_PAGE;
+
+		for (size_t i = 0; i < CONFIG_MMU_PAGE_SIZE / sizeof(uintptr_t); i++) {
+			page[i] = slot->fill;
+		}
+	} else if (slot->size == CONFIG_MMU_PAGE_SIZE) {
+		(void)memcpy(Z_SCRATCH_PAGE, slot->data, CONFIG_MMU_PAGE_SIZE);
+	} else {
+		decompress(slot->data, slot->size, Z_SCRATCH_PAGE);
+	}
+
+	stats.decompressions++;
+	stats.decompress_cycles += k_cycle_get_32() - start;
+}
+
+void k_mem_paging_backing_store_page_finalize(struct z_page_frame *pf,
+					      uintptr_t location)
+{
+	k_mem_paging_backing_store_location_free(location);
+}
+
+void k_mem_paging_backing_store_init(void)
+{
+	void *pages = NULL, *page;
+
+	sys_heap_init(&pool, pool_mem, sizeof(pool_mem));
+
+	/* Count the data pages the pool holds as is, allocator overhead
+	 * included, chaining them through their first word.
+	 */
+	while ((page = sys_heap_alloc(&pool, CONFIG_MMU_PAGE_SIZE)) != NULL) {
+		*(void **)page = pages;
+		pages = page;
+		pool_pages++;
+	}
+	while (pages != NULL) {
+		page = pages;
+		pages = *(void **)page;
+		sys_heap_free(&pool, page);
+	}
+	__ASSERT(pool_pages >= 2U, "compressed pool too small");
+
+	sys_slist_init(&free_slots);
+	for (size_t i = 0; i < ARRAY_SIZE(slots); i++) {
+		sys_slist_append(&free_slots, &slots[i].node);
+	}
+	free_slots_count = ARRAY_SIZE(slots);
+}
+
+void k_mem_paging_backing_store_compressed_stats_get(
+	struct k_mem_paging_backing_store_compressed_stats *out)
+{
+	unsigned int key = irq_lock();
+
+	(void)memcpy(out, &stats, sizeof(stats));
+	irq_unlock(key);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* Page frames are arranged in a circle, which a hand sweeps through
+ * looking for a victim. A page frame whose data page has been accessed
+ * since the hand last passed over it gets a second chance: its accessed
+ * state is cleared and the hand moves on. The first page frame found not
+ * accessed is evicted, and the hand is left past it, so that the data
+ * page loaded into it is given a whole revolution before being
+ * considered again.
+ *
+ * Every page frame is examined at most twice per selection, since the
+ * first pass clears the accessed state of all of them, and the work
+ * done by the hand is proportional to the number of accesses since
+ * the previous selection, rather than to the number of page frames.
+ */
+static size_t clock_hand;
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *pf;
+	uintptr_t flags;
+
+	for (size_t i = 0; i < 2 * Z_NUM_PAGE_FRAMES; i++) {
+		pf = &z_page_frames[clock_hand];
+
+		clock_hand++;
+		if (clock_hand == Z_NUM_PAGE_FRAMES) {
+			clock_hand = 0;
+		}
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Clear accessed bit in page tables, reporting its
+		 * prior state
+		 */
+		flags = arch_page_info_get(pf->addr, NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			/* Second chance */
+			continue;
+		}
+
+		*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		return pf;
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(false, "no page to evict");
+
+	return NULL;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
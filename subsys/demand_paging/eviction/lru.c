@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Least Recently Used (LRU) approximation eviction algorithm for demand
+ * paging, using aging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* Each page frame has an age, holding whether its data page has been
+ * accessed during each of the last eight periods, the most recent one
+ * in the most significant bit. The page frame with the lowest age is
+ * the least recently used. Accesses in the current period, not yet
+ * shifted into the age, count as more recent than all of those.
+ */
+static uint8_t lru_ages[Z_NUM_PAGE_FRAMES];
+
+static void lru_periodic_update(struct k_timer *timer)
+{
+	uintptr_t phys, flags;
+	struct z_page_frame *pf;
+	unsigned int key = irq_lock();
+
+	Z_PAGE_FRAME_FOREACH(phys, pf) {
+		uint8_t *age = &lru_ages[pf - z_page_frames];
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Clear accessed bit in page tables, reporting its
+		 * prior state
+		 */
+		flags = arch_page_info_get(pf->addr, NULL, true);
+
+		*age >>= 1;
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			*age |= BIT(7);
+		}
+	}
+
+	irq_unlock(key);
+}
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	unsigned int last_prec = UINT_MAX;
+	struct z_page_frame *last_pf = NULL, *pf;
+	bool accessed;
+	bool last_dirty = false;
+	bool dirty = false;
+	uintptr_t flags, phys;
+
+	Z_PAGE_FRAME_FOREACH(phys, pf) {
+		unsigned int prec;
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		flags = arch_page_info_get(pf->addr, NULL, false);
+		accessed = (flags & ARCH_DATA_PAGE_ACCESSED) != 0UL;
+		dirty = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		/* Among equally old pages, prefer clean ones */
+		prec = (accessed ? BIT(9) : 0U) +
+		       (lru_ages[pf - z_page_frames] << 1) +
+		       (dirty ? 1U : 0U);
+		if (prec == 0) {
+			/* Never accessed and clean, we're done */
+			last_pf = pf;
+			last_dirty = dirty;
+			break;
+		}
+
+		if (prec < last_prec) {
+			last_prec = prec;
+			last_pf = pf;
+			last_dirty = dirty;
+		}
+	}
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(last_pf != NULL, "no page to evict");
+
+	/* The data page loaded in this page frame starts with no history */
+	if (last_pf != NULL) {
+		lru_ages[last_pf - z_page_frames] = 0U;
+	}
+
+	*dirty_ptr = last_dirty;
+
+	return last_pf;
+}
+
+static K_TIMER_DEFINE(lru_timer, lru_periodic_update, NULL);
+
+void k_mem_paging_eviction_init(void)
+{
+	k_timer_start(&lru_timer, K_NO_WAIT,
+		      K_MSEC(CONFIG_EVICTION_LRU_PERIOD));
+}
@@ -24,6 +24,9 @@
 #if defined(CONFIG_LOG_RUNTIME_FILTERING)
 #include <zephyr/logging/log_ctrl.h>
 #endif
+#if defined(CONFIG_SPIN_LOCK_STATS)
+#include <zephyr/timing/timing.h>
+#endif
 
 #if defined(CONFIG_THREAD_MAX_NAME_LEN)
 #define THREAD_MAX_NAM_LEN CONFIG_THREAD_MAX_NAME_LEN
@@ -93,6 +96,87 @@ static int cmd_kernel_cycles(const struct shell *sh,
 	return 0;
 }
 
+#if defined(CONFIG_SCHED_LATENCY_STATS)
+static void shell_latency_hist_dump(const struct shell *sh, const char *name,
+				    const struct k_sched_latency_hist *hist)
+{
+	uint32_t avg_ns = (hist->count == 0U) ? 0U :
+			  (uint32_t)(hist->total_ns / hist->count);
+
+	shell_print(sh, "\t%s latency: %u times, avg %u ns, max %u ns",
+		    name, hist->count, avg_ns, hist->max_ns);
+}
+
+static void shell_latency_buckets_dump(const struct shell *sh,
+				       const char *name,
+				       const struct k_sched_latency_hist *hist)
+{
+	shell_latency_hist_dump(sh, name, hist);
+
+	if (hist->count == 0U) {
+		return;
+	}
+
+	for (int i = 0; i < CONFIG_SCHED_LATENCY_STATS_BUCKETS; i++) {
+		if (hist->buckets[i] == 0U) {
+			continue;
+		}
+
+		if (i == 0) {
+			shell_print(sh, "\t\t      < 1 us: %u", hist->buckets[i]);
+		} else if (i == CONFIG_SCHED_LATENCY_STATS_BUCKETS - 1) {
+			shell_print(sh, "\t\t>= %6u us: %u", (uint32_t)BIT(i - 1),
+				    hist->buckets[i]);
+		} else {
+			shell_print(sh, "\t\t < %6u us: %u", (uint32_t)BIT(i),
+				    hist->buckets[i]);
+		}
+	}
+}
+
+static int cmd_kernel_latency(const struct shell *sh,
+			      size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct k_sched_latency_stats stats;
+
+	for (int prio = K_HIGHEST_THREAD_PRIO; prio <= K_LOWEST_THREAD_PRIO;
+	     prio++) {
+		(void)k_sched_latency_stats_get(prio, &stats);
+		if (stats.wakeup.count == 0U) {
+			continue;
+		}
+
+		shell_print(sh, "Priority %d:", prio);
+		shell_latency_buckets_dump(sh, "Wakeup", &stats.wakeup);
+		shell_latency_buckets_dump(sh, "Preemption", &stats.preempt);
+		shell_latency_buckets_dump(sh, "Interrupt", &stats.irq);
+	}
+
+	return 0;
+}
+
+static int cmd_kernel_latency_reset(const struct shell *sh,
+				    size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	k_sched_latency_stats_reset();
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_latency,
+	SHELL_CMD(reset, NULL, "Reset scheduling latency statistics.",
+		  cmd_kernel_latency_reset),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+#endif
+
 #if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO) && \
 	defined(CONFIG_THREAD_MONITOR)
 static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
@@ -121,7 +205,7 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 	shell_print(sh, "\toptions: 0x%x, priority: %d timeout: %" PRId64,
 		      thread->base.user_options,
 		      thread->base.prio,
-		      (int64_t)thread->base.timeout.dticks);
+		      (int64_t)k_thread_timeout_remaining_ticks(thread));
 	shell_print(sh, "\tstate: %s, entry: %p",
 		    k_thread_state_str(thread, state_str, sizeof(state_str)),
 		    thread->entry.pEntry);
@@ -158,6 +242,14 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 			    (uint32_t)rt_stats_thread.peak_cycles);
 		shell_print(sh, "\tAverage execution cycles: %u",
 			    (uint32_t)rt_stats_thread.average_cycles);
+#endif
+#ifdef CONFIG_SCHED_LATENCY_STATS
+		shell_latency_hist_dump(sh, "Wakeup",
+					&rt_stats_thread.latency.wakeup);
+		shell_latency_hist_dump(sh, "Preemption",
+					&rt_stats_thread.latency.preempt);
+		shell_latency_hist_dump(sh, "Interrupt",
+					&rt_stats_thread.latency.irq);
 #endif
 	} else {
 		shell_print(sh, "\tTotal execution cycles: ? (? %%)");
@@ -300,6 +392,69 @@ static int cmd_kernel_heap(const struct shell *sh,
 }
 #endif
 
+#if defined(CONFIG_SPIN_LOCK_STATS)
+static void shell_spinlock_stats_dump(const struct k_spinlock_stats *stats,
+				      void *user_data)
+{
+	const struct shell *sh = (const struct shell *)user_data;
+
+	shell_print(sh, "%-12p %-12p %10u %10u %10u %10u %10u",
+		    stats->site, stats->lock, stats->acquired, stats->contended,
+		    (uint32_t)timing_cycles_to_ns_avg(stats->hold_cycles,
+						      stats->acquired),
+		    (uint32_t)timing_cycles_to_ns(stats->hold_cycles_max),
+		    (uint32_t)timing_cycles_to_ns(stats->spin_cycles_max));
+}
+
+static int cmd_kernel_spinlocks(const struct shell *sh,
+				size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%-12s %-12s %10s %10s %10s %10s %10s",
+		    "site", "lock", "acquired", "contended",
+		    "hold avg", "hold max", "spin max");
+	k_spinlock_stats_foreach(shell_spinlock_stats_dump, (void *)sh);
+	shell_print(sh, "Times in ns, %u acquisitions not recorded",
+		    k_spinlock_stats_dropped());
+
+	return 0;
+}
+
+static int cmd_kernel_spinlocks_reset(const struct shell *sh,
+				      size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	k_spinlock_stats_reset();
+
+	return 0;
+}
+
+static int cmd_kernel_spinlocks_trace(const struct shell *sh,
+				      size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	k_spinlock_stats_trace();
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_spinlocks,
+	SHELL_CMD(reset, NULL, "Reset spinlock statistics.",
+		  cmd_kernel_spinlocks_reset),
+	SHELL_CMD(trace, NULL, "Emit spinlock statistics as tracing events.",
+		  cmd_kernel_spinlocks_trace),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+#endif
+
 static int cmd_kernel_sleep(const struct shell *sh,
 			    size_t argc, char **argv)
 {
@@ -400,6 +555,15 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 #endif
 #if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (K_HEAP_MEM_POOL_SIZE > 0)
 	SHELL_CMD(heap, NULL, "System heap usage statistics.", cmd_kernel_heap),
+#endif
+#if defined(CONFIG_SCHED_LATENCY_STATS)
+	SHELL_CMD(latency, &sub_kernel_latency,
+		  "Scheduling latency statistics per priority.",
+		  cmd_kernel_latency),
+#endif
+#if defined(CONFIG_SPIN_LOCK_STATS)
+	SHELL_CMD(spinlocks, &sub_kernel_spinlocks,
+		  "Spinlock statistics per call site.", cmd_kernel_spinlocks),
 #endif
 	SHELL_CMD_ARG(uptime, NULL, "Kernel uptime. Can be called with the -p or --pretty options",
 		      cmd_kernel_uptime, 1, 1),
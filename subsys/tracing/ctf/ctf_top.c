@@ -8,6 +8,9 @@
 #include <zephyr/kernel_structs.h>
 #include <kernel_internal.h>
 #include <ctf_top.h>
+#ifdef CONFIG_SPIN_LOCK_STATS
+#include <zephyr/timing/timing.h>
+#endif
 
 
 static void _get_thread_name(struct k_thread *thread,
@@ -319,3 +322,19 @@ void sys_trace_k_timer_status_sync_exit(struct k_timer *timer, uint32_t result)
 		result
 		);
 }
+
+/* Spinlock */
+#ifdef CONFIG_SPIN_LOCK_STATS
+void sys_trace_k_spinlock_stats(const struct k_spinlock_stats *stats)
+{
+	ctf_top_spinlock_stats(
+		(uint32_t)(uintptr_t)stats->site,
+		(uint32_t)(uintptr_t)stats->lock,
+		stats->acquired,
+		stats->contended,
+		(uint32_t)timing_cycles_to_ns_avg(stats->hold_cycles, stats->acquired),
+		(uint32_t)timing_cycles_to_ns(stats->hold_cycles_max),
+		(uint32_t)timing_cycles_to_ns(stats->spin_cycles_max)
+		);
+}
+#endif
@@ -102,7 +102,8 @@ typedef enum {
 	CTF_EVENT_TIMER_STOP = 0x30,
 	CTF_EVENT_TIMER_STATUS_SYNC_ENTER = 0x31,
 	CTF_EVENT_TIMER_STATUS_SYNC_BLOCKING = 0x32,
-	CTF_EVENT_TIMER_STATUS_SYNC_EXIT = 0x33
+	CTF_EVENT_TIMER_STATUS_SYNC_EXIT = 0x33,
+	CTF_EVENT_SPINLOCK_STATS = 0x34
 
 } ctf_event_t;
 
@@ -328,5 +329,14 @@ static inline void ctf_top_timer_status_sync_exit(uint32_t timer, uint32_t resul
 	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_TIMER_STATUS_SYNC_EXIT), timer, result);
 }
 
+/* Spinlock */
+static inline void ctf_top_spinlock_stats(uint32_t site, uint32_t lock,
+					  uint32_t acquired, uint32_t contended,
+					  uint32_t hold_avg_ns, uint32_t hold_max_ns,
+					  uint32_t spin_max_ns)
+{
+	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_SPINLOCK_STATS), site, lock,
+		  acquired, contended, hold_avg_ns, hold_max_ns, spin_max_ns);
+}
 
 #endif /* SUBSYS_DEBUG_TRACING_CTF_TOP_H */
@@ -326,6 +326,8 @@ extern "C" {
 #define sys_port_trace_k_event_wait_blocking(event, events, options, timeout)
 #define sys_port_trace_k_event_wait_exit(event, events, ret)
 
+#define sys_port_trace_k_spinlock_stats(stats) sys_trace_k_spinlock_stats(stats)
+
 #define sys_port_trace_k_thread_abort_exit(thread)
 #define sys_port_trace_k_thread_abort_enter(thread)
 #define sys_port_trace_k_thread_resume_exit(thread)
@@ -434,6 +436,9 @@ void sys_trace_k_timer_status_sync_exit(struct k_timer *timer, uint32_t result);
 
 void sys_trace_k_event_init(struct k_event *event);
 
+struct k_spinlock_stats;
+void sys_trace_k_spinlock_stats(const struct k_spinlock_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
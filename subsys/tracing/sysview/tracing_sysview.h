@@ -544,6 +544,8 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_event_wait_blocking(event, events, options, timeout)
 #define sys_port_trace_k_event_wait_exit(event, events, ret)
 
+#define sys_port_trace_k_spinlock_stats(stats)
+
 #define sys_port_trace_k_heap_init(heap)                                                           \
 	SEGGER_SYSVIEW_RecordU32(TID_HEAP_INIT, (uint32_t)(uintptr_t)heap)
 
@@ -340,6 +340,14 @@ void sys_trace_k_timer_status_sync_exit(struct k_timer *timer, uint32_t result)
 	TRACING_STRING("%s: %p\n", __func__, timer);
 }
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+void sys_trace_k_spinlock_stats(const struct k_spinlock_stats *stats)
+{
+	TRACING_STRING("%s: %p %u %u\n", __func__, stats->site, stats->acquired,
+		       stats->contended);
+}
+#endif
+
 
 void sys_trace_k_heap_init(struct k_heap *h, void *mem, size_t bytes)
 {
@@ -429,6 +429,8 @@
 #define sys_port_trace_k_event_wait_exit(event, events, ret)   \
 	sys_trace_k_event_wait_exit(event, events, ret)
 
+#define sys_port_trace_k_spinlock_stats(stats) sys_trace_k_spinlock_stats(stats)
+
 #define sys_port_trace_k_thread_abort_exit(thread) sys_trace_k_thread_abort_exit(thread)
 
 #define sys_port_trace_k_thread_abort_enter(thread) sys_trace_k_thread_abort_enter(thread)
@@ -681,4 +683,7 @@ void sys_trace_k_timer_status_sync_exit(struct k_timer *timer, uint32_t result);
 
 void sys_trace_k_event_init(struct k_event *event);
 
+struct k_spinlock_stats;
+void sys_trace_k_spinlock_stats(const struct k_spinlock_stats *stats);
+
 #endif /* ZEPHYR_TRACE_TEST_H */
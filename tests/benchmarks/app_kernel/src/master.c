@@ -73,6 +73,11 @@ K_MUTEX_DEFINE(DEMO_MUTEX);
 K_PIPE_DEFINE(PIPE_NOBUFF, 0, 4);
 K_PIPE_DEFINE(PIPE_SMALLBUFF, 256, 4);
 K_PIPE_DEFINE(PIPE_BIGBUFF, 4096, 4);
+#ifdef CONFIG_PIPE_SPSC
+K_PIPE_SPSC_DEFINE(PIPE_SPSC, 4096, 4);
+
+BENCH_DMEM struct k_pipe *test_spsc_pipes[] = {&PIPE_BIGBUFF, &PIPE_SPSC};
+#endif
 
 /*
  * Custom syscalls
@@ -144,6 +149,9 @@ int main(void)
 #ifdef CONFIG_USERSPACE
 	k_mem_domain_add_partition(&k_mem_domain_default,
 				   &bench_mem_partition);
+#ifdef CONFIG_PIPE_SPSC
+	k_object_access_all_grant(&PIPE_SPSC);
+#endif
 #endif
 
 	bench_test_init();
@@ -51,6 +51,9 @@
 extern char msg[MAX_MSG];
 extern char data_bench[MESSAGE_SIZE];
 extern struct k_pipe *test_pipes[];
+#ifdef CONFIG_PIPE_SPSC
+extern struct k_pipe *test_spsc_pipes[];
+#endif
 extern char sline[];
 
 #define dashline \
@@ -102,6 +105,12 @@ extern struct k_mbox MAILB1;
 extern struct k_pipe PIPE_NOBUFF;
 extern struct k_pipe PIPE_SMALLBUFF;
 extern struct k_pipe PIPE_BIGBUFF;
+#ifdef CONFIG_PIPE_SPSC
+extern struct k_pipe PIPE_SPSC;
+
+/* transfer sizes of the SPSC pipe measurements */
+#define SPSC_PIPE_SIZES 16, 256, 4096
+#endif
 
 
 extern struct k_mem_slab MAP1;
@@ -138,6 +138,40 @@ void pipe_test(void)
 		PRINT_STRING(dashline);
 		k_thread_priority_set(k_current_get(), TaskPrio);
 	}
+
+#ifdef CONFIG_PIPE_SPSC
+	/* regular vs. single reader, single writer pipe, matching (ALL_N) */
+	static const uint32_t spsc_sizes[] = {SPSC_PIPE_SIZES};
+
+	PRINT_STRING("| Regular vs. single reader, single writer (SPSC) "
+		     "pipe, 4096 byte buffer      |\n");
+	PRINT_STRING(dashline);
+	PRINT_STRING("|  size(B)|       time/packet (nsec)        |"
+		     "             KB/sec              |\n");
+	PRINT_STRING(dashline);
+	PRINT_STRING("|         |  regular pipe  |   SPSC pipe    |"
+		     "  regular pipe  |   SPSC pipe    |\n");
+	PRINT_STRING(dashline);
+
+	for (int i = 0; i < ARRAY_SIZE(spsc_sizes); i++) {
+		putsize = spsc_sizes[i];
+		for (pipe = 0; pipe < 2; pipe++) {
+			putcount = NR_OF_PIPE_RUNS;
+			pipeput(test_spsc_pipes[pipe], _ALL_N, putsize,
+				putcount, &puttime[pipe]);
+
+			/* waiting for ack */
+			k_msgq_get(&CH_COMM, &getinfo, K_FOREVER);
+		}
+		PRINT_F("|%9u|%16u|%16u|%16u|%16u|\n", putsize,
+			puttime[0], puttime[1],
+			(uint32_t)(((uint64_t)putsize * 1000000U) /
+				   SAFE_DIVISOR(puttime[0])),
+			(uint32_t)(((uint64_t)putsize * 1000000U) /
+				   SAFE_DIVISOR(puttime[1])));
+	}
+	PRINT_STRING(dashline);
+#endif /* CONFIG_PIPE_SPSC */
 }
 
 
@@ -65,6 +65,24 @@ void piperecvtask(void)
 		}
 	}
 
+#ifdef CONFIG_PIPE_SPSC
+	/* regular vs. single reader, single writer pipe, matching (ALL_N) */
+	static const int spsc_sizes[] = {SPSC_PIPE_SIZES};
+
+	for (int i = 0; i < ARRAY_SIZE(spsc_sizes); i++) {
+		getsize = spsc_sizes[i];
+		for (pipe = 0; pipe < 2; pipe++) {
+			getcount = NR_OF_PIPE_RUNS;
+			pipeget(test_spsc_pipes[pipe], _ALL_N, getsize,
+				getcount, &gettime);
+			getinfo.time = gettime;
+			getinfo.size = getsize;
+			getinfo.count = getcount;
+			/* acknowledge to master */
+			k_msgq_put(&CH_COMM, &getinfo, K_FOREVER);
+		}
+	}
+#endif /* CONFIG_PIPE_SPSC */
 }
 
 
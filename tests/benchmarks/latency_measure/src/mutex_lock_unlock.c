@@ -9,34 +9,43 @@
  * @file measure time for mutex lock and unlock
  *
  * This file contains the test that measures mutex lock and unlock times
- * in the kernel. There is no contention on the mutex being tested.
+ * in the kernel, for both k_mutex and sys_mutex. There is no contention on
+ * the mutex being tested.
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/mutex.h>
 #include <zephyr/timing/timing.h>
 #include "utils.h"
 #include "timing_sc.h"
 
 static K_MUTEX_DEFINE(test_mutex);
+BENCH_BMEM SYS_MUTEX_DEFINE(test_sys_mutex);
 
 static void start_lock_unlock(void *p1, void *p2, void *p3)
 {
 	uint32_t  i;
 	uint32_t  num_iterations = (uint32_t)(uintptr_t)p1;
+	bool      sys = (bool)(uintptr_t)p2;
 	timing_t  start;
 	timing_t  finish;
 	uint64_t  lock_cycles;
 	uint64_t  unlock_cycles;
 
-	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
 	start = timing_timestamp_get();
 
 	/* Recursively lock take the mutex */
 
-	for (i = 0; i < num_iterations; i++) {
-		k_mutex_lock(&test_mutex, K_NO_WAIT);
+	if (sys) {
+		for (i = 0; i < num_iterations; i++) {
+			sys_mutex_lock(&test_sys_mutex, K_NO_WAIT);
+		}
+	} else {
+		for (i = 0; i < num_iterations; i++) {
+			k_mutex_lock(&test_mutex, K_NO_WAIT);
+		}
 	}
 
 	finish = timing_timestamp_get();
@@ -47,8 +56,14 @@ static void start_lock_unlock(void *p1, void *p2, void *p3)
 
 	/* Recursively unlock the mutex */
 
-	for (i = 0; i < num_iterations; i++) {
-		k_mutex_unlock(&test_mutex);
+	if (sys) {
+		for (i = 0; i < num_iterations; i++) {
+			sys_mutex_unlock(&test_sys_mutex);
+		}
+	} else {
+		for (i = 0; i < num_iterations; i++) {
+			k_mutex_unlock(&test_mutex);
+		}
 	}
 
 	finish = timing_timestamp_get();
@@ -62,16 +77,7 @@ static void start_lock_unlock(void *p1, void *p2, void *p3)
 }
 
 
-/**
- *
- * @brief Test for the multiple mutex lock/unlock time
- *
- * The routine performs multiple mutex locks and then multiple mutex
- * unlocks to measure the necessary time.
- *
- * @return 0 on success
- */
-int mutex_lock_unlock(uint32_t num_iterations, uint32_t options)
+static void lock_unlock(uint32_t num_iterations, uint32_t options, bool sys)
 {
 	char tag[50];
 	char description[120];
@@ -85,8 +91,8 @@ int mutex_lock_unlock(uint32_t num_iterations, uint32_t options)
 	k_thread_create(&start_thread, start_stack,
 			K_THREAD_STACK_SIZEOF(start_stack),
 			start_lock_unlock,
-			(void *)(uintptr_t)num_iterations, NULL, NULL,
-			priority - 1, options, K_FOREVER);
+			(void *)(uintptr_t)num_iterations, (void *)(uintptr_t)sys,
+			NULL, priority - 1, options, K_FOREVER);
 
 	k_thread_access_grant(&start_thread, &test_mutex, &pause_sem);
 	k_thread_start(&start_thread);
@@ -95,7 +101,7 @@ int mutex_lock_unlock(uint32_t num_iterations, uint32_t options)
 	k_sem_give(&pause_sem);
 
 	snprintf(tag, sizeof(tag),
-		 "mutex.lock.immediate.recursive.%s",
+		 "%s.lock.immediate.recursive.%s", sys ? "sys_mutex" : "mutex",
 		 (options & K_USER) == K_USER ? "user" : "kernel");
 	snprintf(description, sizeof(description),
 		 "%-40s - Lock a mutex", tag);
@@ -105,7 +111,7 @@ int mutex_lock_unlock(uint32_t num_iterations, uint32_t options)
 	cycles = timestamp.cycles;
 
 	snprintf(tag, sizeof(tag),
-		 "mutex.unlock.immediate.recursive.%s",
+		 "%s.unlock.immediate.recursive.%s", sys ? "sys_mutex" : "mutex",
 		 (options & K_USER) == K_USER ? "user" : "kernel");
 	snprintf(description, sizeof(description),
 		 "%-40s - Unlock a mutex", tag);
@@ -113,5 +119,34 @@ int mutex_lock_unlock(uint32_t num_iterations, uint32_t options)
 			false, "");
 
 	timing_stop();
+}
+
+/**
+ *
+ * @brief Test for the multiple mutex lock/unlock time
+ *
+ * The routine performs multiple mutex locks and then multiple mutex
+ * unlocks to measure the necessary time.
+ *
+ * @return 0 on success
+ */
+int mutex_lock_unlock(uint32_t num_iterations, uint32_t options)
+{
+	lock_unlock(num_iterations, options, false);
+	return 0;
+}
+
+/**
+ *
+ * @brief Test for the multiple sys_mutex lock/unlock time
+ *
+ * Same as mutex_lock_unlock(), but on a sys_mutex. With
+ * CONFIG_SYS_MUTEX_FAST_PATH, user threads do this without any system call.
+ *
+ * @return 0 on success
+ */
+int sys_mutex_lock_unlock(uint32_t num_iterations, uint32_t options)
+{
+	lock_unlock(num_iterations, options, true);
 	return 0;
 }
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Multi-producer, multi-consumer FIFO benchmark: one producer and one
+ * consumer thread are pinned to each CPU, all of them sharing a single
+ * FIFO.  Producers cycle through a pool of items, waiting for each one
+ * to be marked free by the consumer that got it before putting it again.
+ */
+
+#define NUM_PRODUCERS CONFIG_MP_MAX_NUM_CPUS
+#define NUM_CONSUMERS CONFIG_MP_MAX_NUM_CPUS
+#define POOL_SIZE     32
+#define RUN_MS        2000
+#define STACK_SIZE    (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct item {
+	void *fifo_reserved;
+	atomic_t busy;
+};
+
+struct consumer {
+	uint32_t items;
+	uint32_t waits;
+};
+
+#ifdef CONFIG_QUEUE_LOCKLESS
+K_FIFO_LOCKLESS_DEFINE(fifo);
+#else
+K_FIFO_DEFINE(fifo);
+#endif
+
+static struct item pools[NUM_PRODUCERS][POOL_SIZE];
+static struct item stop_items[NUM_CONSUMERS];
+static struct consumer consumers[NUM_CONSUMERS];
+static struct k_thread threads[NUM_PRODUCERS + NUM_CONSUMERS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_PRODUCERS + NUM_CONSUMERS,
+				   STACK_SIZE);
+
+static volatile bool running;
+
+static void producer_fn(void *p1, void *p2, void *p3)
+{
+	struct item *pool = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; running; i = (i + 1) % POOL_SIZE) {
+		while (atomic_get(&pool[i].busy) != 0) {
+			if (!running) {
+				return;
+			}
+			k_yield();
+		}
+
+		atomic_set(&pool[i].busy, 1);
+		k_fifo_put(&fifo, &pool[i]);
+	}
+}
+
+static void consumer_fn(void *p1, void *p2, void *p3)
+{
+	struct consumer *c = p1;
+	struct item *item;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		item = k_fifo_get(&fifo, K_NO_WAIT);
+		if (item == NULL) {
+			c->waits++;
+			item = k_fifo_get(&fifo, K_FOREVER);
+		}
+
+		if (PART_OF_ARRAY(stop_items, item)) {
+			break;
+		}
+
+		c->items++;
+		atomic_clear(&item->busy);
+	}
+}
+
+int main(void)
+{
+	uint64_t items = 0, waits = 0;
+
+	printk("fifo: %s\n",
+	       IS_ENABLED(CONFIG_QUEUE_LOCKLESS) ? "lockless" : "locked");
+
+	running = true;
+
+	for (int i = 0; i < NUM_CONSUMERS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				consumer_fn, &consumers[i], NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+		k_thread_cpu_pin(&threads[i], i % CONFIG_MP_MAX_NUM_CPUS);
+	}
+
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		int t = NUM_CONSUMERS + i;
+
+		k_thread_create(&threads[t], stacks[t], STACK_SIZE,
+				producer_fn, pools[i], NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+		k_thread_cpu_pin(&threads[t], i % CONFIG_MP_MAX_NUM_CPUS);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(threads); i++) {
+		k_thread_start(&threads[i]);
+	}
+
+	k_sleep(K_MSEC(RUN_MS));
+	running = false;
+
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		k_thread_join(&threads[NUM_CONSUMERS + i], K_FOREVER);
+	}
+
+	/* Consumers drain the items left before getting their stop item */
+	for (int i = 0; i < NUM_CONSUMERS; i++) {
+		k_fifo_put(&fifo, &stop_items[i]);
+	}
+
+	for (int i = 0; i < NUM_CONSUMERS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		items += consumers[i].items;
+		waits += consumers[i].waits;
+	}
+
+	printk("cpus %2d producers %2d consumers %2d items %9u /s waits %8u /s\n",
+	       CONFIG_MP_MAX_NUM_CPUS, NUM_PRODUCERS, NUM_CONSUMERS,
+	       (uint32_t)(items * MSEC_PER_SEC / RUN_MS),
+	       (uint32_t)(waits * MSEC_PER_SEC / RUN_MS));
+
+	printk("fin\n");
+	return 0;
+}
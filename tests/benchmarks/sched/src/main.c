@@ -88,6 +88,117 @@ static void partner_fn(void *arg1, void *arg2, void *arg3)
 	}
 }
 
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_CPU_MASK)
+/* SMP scaling runs: a "waker" thread stamps the time and gives a
+ * semaphore a higher priority "wakee" thread is waiting on, which
+ * stamps the time again as soon as it runs and gives the waker
+ * another semaphore back.  One such pair runs concurrently on each of
+ * 1 to SMP_MAX_CPUS CPUs, either with both threads pinned to the same
+ * CPU (measuring the wakeup and context switch on that CPU) or with
+ * the wakee pinned to the next CPU (measuring the wakeup of a thread
+ * on another CPU, including the IPI), so the latencies can be
+ * compared as more CPUs compete for the scheduler.
+ */
+#define SMP_MAX_CPUS MIN(CONFIG_MP_MAX_NUM_CPUS, 4)
+#define SMP_RUNS 1000
+
+struct smp_pair {
+	struct k_sem wake;
+	struct k_sem done;
+	uint32_t start;
+	uint64_t tot;
+};
+
+static struct smp_pair pairs[SMP_MAX_CPUS];
+static struct k_thread smp_threads[2 * SMP_MAX_CPUS];
+static K_THREAD_STACK_ARRAY_DEFINE(smp_stacks, 2 * SMP_MAX_CPUS, 1024);
+
+static void waker_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct smp_pair *p = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (int i = 0; i < SMP_RUNS + N_SETTLE; i++) {
+		p->start = k_cycle_get_32();
+		k_sem_give(&p->wake);
+		k_sem_take(&p->done, K_FOREVER);
+	}
+}
+
+static void wakee_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct smp_pair *p = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (int i = 0; i < SMP_RUNS + N_SETTLE; i++) {
+		k_sem_take(&p->wake, K_FOREVER);
+		if (i >= N_SETTLE) {
+			p->tot += k_cycle_get_32() - p->start;
+		}
+		k_sem_give(&p->done);
+	}
+}
+
+/* Returns the average wakeup latency over all pairs */
+static uint32_t smp_run(int ncpus, bool remote)
+{
+	uint64_t tot = 0U;
+
+	for (int i = 0; i < ncpus; i++) {
+		struct smp_pair *p = &pairs[i];
+		struct k_thread *waker = &smp_threads[2 * i];
+		struct k_thread *wakee = &smp_threads[2 * i + 1];
+
+		k_sem_init(&p->wake, 0, 1);
+		k_sem_init(&p->done, 0, 1);
+		p->tot = 0U;
+
+		k_thread_create(waker, smp_stacks[2 * i],
+				K_THREAD_STACK_SIZEOF(smp_stacks[2 * i]),
+				waker_fn, p, NULL, NULL,
+				K_PRIO_PREEMPT(2), 0, K_FOREVER);
+		k_thread_create(wakee, smp_stacks[2 * i + 1],
+				K_THREAD_STACK_SIZEOF(smp_stacks[2 * i + 1]),
+				wakee_fn, p, NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+		k_thread_cpu_pin(waker, i);
+		k_thread_cpu_pin(wakee, remote ? (i + 1) % ncpus : i);
+	}
+
+	for (int i = 0; i < 2 * ncpus; i++) {
+		k_thread_start(&smp_threads[i]);
+	}
+
+	for (int i = 0; i < 2 * ncpus; i++) {
+		k_thread_join(&smp_threads[i], K_FOREVER);
+	}
+
+	for (int i = 0; i < ncpus; i++) {
+		tot += pairs[i].tot;
+	}
+
+	return tot / (ncpus * SMP_RUNS);
+}
+
+static void smp_bench(void)
+{
+	int max_cpus = MIN(arch_num_cpus(), SMP_MAX_CPUS);
+
+	for (int ncpus = 1; ncpus <= max_cpus; ncpus++) {
+		uint32_t local = smp_run(ncpus, false);
+		uint32_t remote = smp_run(ncpus, true);
+
+		/* With a single CPU, the "remote" wakee is local too */
+		printk("smp cpus %d switch %4d wakeup %4d\n",
+		       ncpus, local, remote);
+	}
+}
+#endif /* CONFIG_SMP && CONFIG_SCHED_CPU_MASK */
+
 int main(void)
 {
 	z_waitq_init(&waitq);
@@ -150,6 +261,11 @@ int main(void)
 		       stamps[4] - stamps[3],
 		       whole, avg);
 	}
+
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_CPU_MASK)
+	smp_bench();
+#endif /* CONFIG_SMP && CONFIG_SCHED_CPU_MASK */
+
 	printk("fin\n");
 	return 0;
 }
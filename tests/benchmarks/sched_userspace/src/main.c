@@ -5,6 +5,8 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/mutex.h>
+#include <zephyr/sys/sem.h>
 #include <zephyr/sys/printk.h>
 
 /* private kernel APIs */
@@ -17,6 +19,8 @@
 #define MAIN_PRIO 8
 #define THREADS_PRIO 9
 
+#define MAX_NB_OBJECTS 5000
+
 enum {
 	MEAS_START,
 	MEAS_END,
@@ -45,9 +49,17 @@ static inline int stamp(int state)
 
 static int yielder_status;
 
-void yielder_entry(void *_thread, void *_tid, void *_nb_threads)
+/* Uncontended user mode synchronization objects, in the partition of the
+ * first application thread
+ */
+K_APP_BMEM(app_1_partition) SYS_MUTEX_DEFINE(user_mutex);
+K_APP_DMEM(app_1_partition) SYS_SEM_DEFINE(user_sem, 0, 1);
+
+/* Always available semaphore, so that giving it never wakes anyone up */
+K_SEM_DEFINE(batch_sem, 1, 1);
+
+static int enter_domain(struct k_app_thread *thread)
 {
-	struct k_app_thread *thread = (struct k_app_thread *) _thread;
 	int ret;
 
 	struct k_mem_partition *parts[] = {
@@ -58,14 +70,52 @@ void yielder_entry(void *_thread, void *_tid, void *_nb_threads)
 	if (ret != 0) {
 		printk("k_mem_domain_init failed %d\n", ret);
 		yielder_status = 1;
-		return;
+		return ret;
 	}
 
 	k_mem_domain_add_thread(&thread->domain, k_current_get());
 
+	return 0;
+}
+
+void yielder_entry(void *_thread, void *_tid, void *_nb_threads)
+{
+	struct k_app_thread *thread = (struct k_app_thread *) _thread;
+
+	if (enter_domain(thread) != 0) {
+		return;
+	}
+
 	k_thread_user_mode_enter(context_switch_yield, _nb_threads, NULL, NULL);
 }
 
+void locker_entry(void *_thread, void *_fn, void *_obj)
+{
+	struct k_app_thread *thread = (struct k_app_thread *) _thread;
+
+	if (enter_domain(thread) != 0) {
+		return;
+	}
+
+	k_thread_user_mode_enter((k_thread_entry_t)_fn, _obj, NULL, NULL);
+}
+
+#ifdef CONFIG_SYSCALL_BATCH
+void batcher_entry(void *_thread, void *_sem, void *_batch_size)
+{
+	struct k_app_thread *thread = (struct k_app_thread *) _thread;
+
+	if (enter_domain(thread) != 0) {
+		return;
+	}
+
+	if (_batch_size == NULL) {
+		k_thread_user_mode_enter(sem_give, _sem, NULL, NULL);
+	} else {
+		k_thread_user_mode_enter(sem_give_batch, _sem, _batch_size, NULL);
+	}
+}
+#endif /* CONFIG_SYSCALL_BATCH */
 
 static k_tid_t threads[MAX_NB_THREADS];
 
@@ -116,6 +166,118 @@ static int exec_test(uint8_t nb_threads)
 	return yielder_status;
 }
 
+static int exec_lock_test(const char *name, k_thread_entry_t fn, void *obj)
+{
+	yielder_status = 0;
+
+	app_threads[0].partition = app_partitions[0];
+	app_threads[0].stack = &app_thread_stacks[0];
+
+	threads[0] = k_thread_create(&app_threads[0].thread,
+				     app_thread_stacks[0], APP_STACKSIZE,
+				     locker_entry, &app_threads[0], fn, obj,
+				     THREADS_PRIO, 0, K_FOREVER);
+
+	k_thread_priority_set(k_current_get(), MAIN_PRIO);
+
+	stamp(MEAS_START);
+	k_thread_start(threads[0]);
+	k_thread_join(threads[0], K_FOREVER);
+	stamp(MEAS_END);
+
+	uint32_t full_time = stamps[MEAS_END] - stamps[MEAS_START];
+	uint64_t time_ns = k_cyc_to_ns_near64(full_time) / NB_LOCKS;
+
+	printk("%-16s %8" PRIu32 " cyc & %6" PRIu32 " rounds -> %6"
+	       PRIu64 " ns per pair\n", name, full_time, NB_LOCKS, time_ns);
+
+	return yielder_status;
+}
+
+/* Runs a system call validating a dynamic semaphore from user mode, with
+ * nb_objects dynamic objects allocated.  The semaphore being validated is
+ * the last one allocated.
+ */
+static int exec_lookup_test(size_t nb_objects)
+{
+	static void *objects[MAX_NB_OBJECTS];
+	static size_t allocated;
+	struct k_sem *sem;
+
+	while (allocated < nb_objects) {
+		objects[allocated] = k_object_alloc(K_OBJ_SEM);
+		if (objects[allocated] == NULL) {
+			printk("k_object_alloc failed after %zu objects\n", allocated);
+			return 1;
+		}
+		k_sem_init(objects[allocated], 0, 1);
+		allocated++;
+	}
+
+	sem = objects[nb_objects - 1];
+	yielder_status = 0;
+
+	app_threads[0].partition = app_partitions[0];
+	app_threads[0].stack = &app_thread_stacks[0];
+
+	threads[0] = k_thread_create(&app_threads[0].thread,
+				     app_thread_stacks[0], APP_STACKSIZE,
+				     locker_entry, &app_threads[0], sem_count_get,
+				     sem, THREADS_PRIO, 0, K_FOREVER);
+	k_object_access_grant(sem, threads[0]);
+
+	k_thread_priority_set(k_current_get(), MAIN_PRIO);
+
+	stamp(MEAS_START);
+	k_thread_start(threads[0]);
+	k_thread_join(threads[0], K_FOREVER);
+	stamp(MEAS_END);
+
+	uint32_t full_time = stamps[MEAS_END] - stamps[MEAS_START];
+	uint64_t time_ns = k_cyc_to_ns_near64(full_time) / NB_LOOKUPS;
+
+	printk("%4zu objects      %8" PRIu32 " cyc & %6" PRIu32 " rounds -> %6"
+	       PRIu64 " ns per call\n", nb_objects, full_time, NB_LOOKUPS,
+	       time_ns);
+
+	return yielder_status;
+}
+
+#ifdef CONFIG_SYSCALL_BATCH
+/* Gives a semaphore from user mode, batch_size times per system call, or
+ * with one system call per give if batch_size is 0.
+ */
+static int exec_batch_test(size_t batch_size)
+{
+	yielder_status = 0;
+
+	app_threads[0].partition = app_partitions[0];
+	app_threads[0].stack = &app_thread_stacks[0];
+
+	threads[0] = k_thread_create(&app_threads[0].thread,
+				     app_thread_stacks[0], APP_STACKSIZE,
+				     batcher_entry, &app_threads[0], &batch_sem,
+				     (void *)(uintptr_t)batch_size,
+				     THREADS_PRIO, 0, K_FOREVER);
+	k_object_access_grant(&batch_sem, threads[0]);
+
+	k_thread_priority_set(k_current_get(), MAIN_PRIO);
+
+	stamp(MEAS_START);
+	k_thread_start(threads[0]);
+	k_thread_join(threads[0], K_FOREVER);
+	stamp(MEAS_END);
+
+	uint32_t full_time = stamps[MEAS_END] - stamps[MEAS_START];
+	uint64_t time_ns = k_cyc_to_ns_near64(full_time) / NB_GIVES;
+
+	printk("batches of %2zu    %8" PRIu32 " cyc & %6" PRIu32 " rounds -> %6"
+	       PRIu64 " ns per give\n", batch_size, full_time, NB_GIVES,
+	       time_ns);
+
+	return yielder_status;
+}
+#endif /* CONFIG_SYSCALL_BATCH */
 
 int main(void)
 {
@@ -136,6 +298,47 @@ int main(void)
 		}
 	}
 
+	printk("============================\n");
+	printk("user mode uncontended lock/unlock (%s sys_mutex fast path)\n",
+	       IS_ENABLED(CONFIG_SYS_MUTEX_FAST_PATH) ? "with" : "without");
+
+	ret = exec_lock_test("sys_mutex", sys_mutex_lock_unlock, &user_mutex);
+	if (ret == 0) {
+		ret = exec_lock_test("sys_sem", sys_sem_give_take, &user_sem);
+	}
+	if (ret != 0) {
+		printk("FAIL\n");
+		return 0;
+	}
+
+	size_t nb_objects_list[] = {10, 100, 1000, MAX_NB_OBJECTS, 0};
+
+	printk("============================\n");
+	printk("user mode k_sem_count_get() on a dynamic semaphore\n");
+
+	for (size_t i = 0; nb_objects_list[i] > 0; i++) {
+		ret = exec_lookup_test(nb_objects_list[i]);
+		if (ret != 0) {
+			printk("FAIL\n");
+			return 0;
+		}
+	}
+
+#ifdef CONFIG_SYSCALL_BATCH
+	size_t batch_size_list[] = {0, 1, 4, MAX_BATCH_SIZE};
+
+	printk("============================\n");
+	printk("user mode k_sem_give(), batched with k_syscall_batch()\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(batch_size_list); i++) {
+		ret = exec_batch_test(batch_size_list[i]);
+		if (ret != 0) {
+			printk("FAIL\n");
+			return 0;
+		}
+	}
+#endif /* CONFIG_SYSCALL_BATCH */
+
 	printk("SUCCESS\n");
 	return 0;
 }
@@ -7,6 +7,9 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/mutex.h>
+#include <zephyr/sys/sem.h>
+#include <zephyr/sys/syscall_batch.h>
 
 #include "user.h"
 
@@ -19,3 +22,61 @@ void context_switch_yield(void *p1, void *p2, void *p3)
 		k_yield();
 	}
 }
+
+void sys_mutex_lock_unlock(void *p1, void *p2, void *p3)
+{
+	struct sys_mutex *mutex = p1;
+
+	for (uint32_t i = 0; i < NB_LOCKS; i++) {
+		sys_mutex_lock(mutex, K_FOREVER);
+		sys_mutex_unlock(mutex);
+	}
+}
+
+void sys_sem_give_take(void *p1, void *p2, void *p3)
+{
+	struct sys_sem *sem = p1;
+
+	for (uint32_t i = 0; i < NB_LOCKS; i++) {
+		sys_sem_give(sem);
+		sys_sem_take(sem, K_FOREVER);
+	}
+}
+
+void sem_count_get(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem = p1;
+
+	for (uint32_t i = 0; i < NB_LOOKUPS; i++) {
+		(void)k_sem_count_get(sem);
+	}
+}
+
+void sem_give(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem = p1;
+
+	for (uint32_t i = 0; i < NB_GIVES; i++) {
+		k_sem_give(sem);
+	}
+}
+
+#ifdef CONFIG_SYSCALL_BATCH
+void sem_give_batch(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem = p1;
+	size_t batch_size = (size_t)(uintptr_t)p2;
+	struct k_syscall_desc descs[MAX_BATCH_SIZE];
+
+	for (size_t i = 0; i < batch_size; i++) {
+		descs[i] = (struct k_syscall_desc) {
+			.id = K_SYSCALL_K_SEM_GIVE,
+			.args = { (uintptr_t)sem },
+		};
+	}
+
+	for (uint32_t i = 0; i < NB_GIVES / batch_size; i++) {
+		(void)k_syscall_batch(descs, batch_size);
+	}
+}
+#endif /* CONFIG_SYSCALL_BATCH */
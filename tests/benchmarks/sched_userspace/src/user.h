@@ -5,5 +5,14 @@
  */
 
 #define NB_YIELDS UINT32_C(1000000)
+#define NB_LOCKS UINT32_C(1000000)
+#define NB_LOOKUPS UINT32_C(100000)
+#define NB_GIVES UINT32_C(1000000)
+#define MAX_BATCH_SIZE 16
 
 void context_switch_yield(void *p1, void *p2, void *p3);
+void sys_mutex_lock_unlock(void *p1, void *p2, void *p3);
+void sys_sem_give_take(void *p1, void *p2, void *p3);
+void sem_count_get(void *p1, void *p2, void *p3);
+void sem_give(void *p1, void *p2, void *p3);
+void sem_give_batch(void *p1, void *p2, void *p3);
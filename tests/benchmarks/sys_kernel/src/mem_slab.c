@@ -66,6 +66,30 @@ static int mem_slab_free_test(int no_of_loops)
 	return i;
 }
 
+/**
+ *
+ * @brief Memslab allocation/free test function.
+ *		  This test repeatedly allocates a block and frees it.
+ *
+ * @param no_of_loops  Amount of loops to run.
+ *
+ * @return NUmber of done loops.
+ */
+static int mem_slab_alloc_free_test(int no_of_loops)
+{
+	int i;
+
+	for (i = 0; i < no_of_loops; i++) {
+		if (k_mem_slab_alloc(&my_slab, &slab_array[0], K_NO_WAIT)
+		    != 0) {
+			return i;
+		}
+		k_mem_slab_free(&my_slab, slab_array[0]);
+	}
+
+	return i;
+}
+
 int mem_slab_test(void)
 {
 	uint32_t t;
@@ -103,5 +127,23 @@ int mem_slab_test(void)
 
 	return_value += check_result(i, t);
 
+	/* Test k_mem_slab_alloc/k_mem_slab_free in steady state. */
+	fprintf(output_file, sz_test_case_fmt,
+		"Memslab #3");
+	fprintf(output_file, sz_description,
+		"\n\tk_mem_slab_alloc"
+		"\n\tk_mem_slab_free");
+	printf(sz_test_start_fmt);
+
+	t = BENCH_START();
+	i = mem_slab_alloc_free_test(number_of_loops);
+	t = TIME_STAMP_DELTA_GET(t);
+
+	if (k_mem_slab_num_used_get(&my_slab) != 0) {
+		i = 0;
+	}
+
+	return_value += check_result(i, t);
+
 	return return_value;
 }
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <timeout_q.h>
+
+/* This is a timeout queue microbenchmark, measuring the cost of the
+ * raw z_add_timeout()/z_abort_timeout()/sys_clock_announce()
+ * operations with a growing number of timeouts pending, independent
+ * of the k_timer/k_work/k_sleep APIs built on top of them.  All
+ * measurements are taken with interrupts locked so that no tick gets
+ * processed in the middle of a run.
+ */
+
+#define MAX_TIMEOUTS 10000
+
+/* Insert/cancel timeouts are scattered over this many ticks, far
+ * enough in the future that none of them can expire during a run.
+ */
+#define SCATTER_TICKS 10007
+#define SCATTER_BASE  1000
+
+/* Expiry runs arm their timeouts over this many ticks */
+#define EXPIRY_TICKS 4
+
+static struct _timeout timeouts[MAX_TIMEOUTS];
+
+static const int counts[] = { 10, 1000, MAX_TIMEOUTS };
+
+static volatile int expired;
+static int expire_target;
+static timing_t expire_end;
+
+static void expire_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	if (++expired == expire_target) {
+		expire_end = timing_counter_get();
+	}
+}
+
+static void null_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+}
+
+static uint32_t per_op_ns(timing_t start, timing_t end, int n)
+{
+	return (uint32_t)(timing_cycles_to_ns(timing_cycles_get(&start, &end)) / n);
+}
+
+static void bench(int n)
+{
+	timing_t start, end;
+	uint32_t insert_ns, cancel_ns, expire_ns;
+	unsigned int key;
+
+	for (int i = 0; i < n; i++) {
+		z_init_timeout(&timeouts[i]);
+	}
+
+	key = irq_lock();
+
+	start = timing_counter_get();
+	for (int i = 0; i < n; i++) {
+		k_ticks_t ticks = SCATTER_BASE + ((i * 7919) % SCATTER_TICKS);
+
+		z_add_timeout(&timeouts[i], null_fn, K_TICKS(ticks));
+	}
+	end = timing_counter_get();
+	insert_ns = per_op_ns(start, end, n);
+
+	start = timing_counter_get();
+	for (int i = 0; i < n; i++) {
+		z_abort_timeout(&timeouts[i]);
+	}
+	end = timing_counter_get();
+	cancel_ns = per_op_ns(start, end, n);
+
+	/* Arm everything to expire within a few ticks, then keep
+	 * interrupts locked until all of it is due so that a single
+	 * sys_clock_announce() runs the whole batch.
+	 */
+	expired = 0;
+	expire_target = n;
+	for (int i = 0; i < n; i++) {
+		z_add_timeout(&timeouts[i], expire_fn,
+			      K_TICKS(i % EXPIRY_TICKS));
+	}
+	k_busy_wait(k_ticks_to_us_ceil32(EXPIRY_TICKS + 2));
+
+	start = timing_counter_get();
+	irq_unlock(key);
+
+	while (expired < n) {
+		k_sleep(K_TICKS(1));
+	}
+	expire_ns = per_op_ns(start, expire_end, n);
+
+	printk("timeouts %5d insert %6u ns cancel %6u ns expire %6u ns\n",
+	       n, insert_ns, cancel_ns, expire_ns);
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	printk("timeout queue backend: %s\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) ? "wheel" : "dlist");
+
+	for (int i = 0; i < ARRAY_SIZE(counts); i++) {
+		bench(counts[i]);
+	}
+
+	timing_stop();
+	printk("fin\n");
+	return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Multi-core timeout queue stress test: THREADS_PER_CPU threads are
+ * pinned to each CPU, each one keeping a periodic timer expiring on
+ * every tick while arming and cancelling a batch of other timers as
+ * fast as it can.  The aggregate throughput is reported at the end.
+ */
+
+#define THREADS_PER_CPU 2
+#define NUM_THREADS     (CONFIG_MP_MAX_NUM_CPUS * THREADS_PER_CPU)
+#define TIMERS          16
+#define RUN_MS          2000
+#define STACK_SIZE      (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct worker {
+	struct k_timer periodic;
+	struct k_timer timers[TIMERS];
+	atomic_t expiries;
+	uint32_t ops;
+};
+
+static struct worker workers[NUM_THREADS];
+static struct k_thread threads[NUM_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+
+static volatile bool running;
+
+static void periodic_fn(struct k_timer *timer)
+{
+	struct worker *w = CONTAINER_OF(timer, struct worker, periodic);
+
+	atomic_inc(&w->expiries);
+}
+
+static void worker_fn(void *p1, void *p2, void *p3)
+{
+	struct worker *w = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_timer_start(&w->periodic, K_TICKS(1), K_TICKS(1));
+
+	while (running) {
+		for (int i = 0; i < TIMERS; i++) {
+			k_timer_start(&w->timers[i], K_MSEC(10 + i), K_NO_WAIT);
+		}
+		for (int i = 0; i < TIMERS; i++) {
+			k_timer_stop(&w->timers[i]);
+		}
+		w->ops += 2 * TIMERS;
+	}
+
+	k_timer_stop(&w->periodic);
+}
+
+int main(void)
+{
+	uint64_t ops = 0, expiries = 0;
+
+	printk("timeout queues: %s\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_PER_CPU) ? "per-CPU" : "global");
+
+	running = true;
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_timer_init(&workers[i].periodic, periodic_fn, NULL);
+		for (int j = 0; j < TIMERS; j++) {
+			k_timer_init(&workers[i].timers[j], NULL, NULL);
+		}
+
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, worker_fn,
+				&workers[i], NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+		k_thread_cpu_pin(&threads[i], i % CONFIG_MP_MAX_NUM_CPUS);
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_start(&threads[i]);
+	}
+
+	k_sleep(K_MSEC(RUN_MS));
+	running = false;
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		ops += workers[i].ops;
+		expiries += atomic_get(&workers[i].expiries);
+	}
+
+	printk("cpus %2d threads %3d arm/cancel %9u ops/s expiries %7u /s\n",
+	       CONFIG_MP_MAX_NUM_CPUS, NUM_THREADS,
+	       (uint32_t)(ops * MSEC_PER_SEC / RUN_MS),
+	       (uint32_t)(expiries * MSEC_PER_SEC / RUN_MS));
+
+	printk("fin\n");
+	return 0;
+}
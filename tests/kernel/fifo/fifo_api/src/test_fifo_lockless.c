@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifdef CONFIG_QUEUE_LOCKLESS
+
+#include "test_fifo.h"
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define LIST_LEN 4
+#define NUM_PRODUCERS 2
+#define NUM_CONSUMERS 2
+#define ITEMS_PER_PRODUCER 64
+
+/**TESTPOINT: init via K_FIFO_LOCKLESS_DEFINE*/
+K_FIFO_LOCKLESS_DEFINE(lfifo);
+
+static struct k_fifo fifo_ll;
+static fdata_t data[LIST_LEN];
+static fdata_t items[NUM_PRODUCERS][ITEMS_PER_PRODUCER];
+static uint32_t last_seen[NUM_CONSUMERS][NUM_PRODUCERS];
+static uint32_t received[NUM_CONSUMERS];
+
+static K_THREAD_STACK_ARRAY_DEFINE(tstacks, NUM_PRODUCERS + NUM_CONSUMERS,
+				   STACK_SIZE);
+static struct k_thread tdata[NUM_PRODUCERS + NUM_CONSUMERS];
+
+static void tfifo_put_get(struct k_fifo *pfifo)
+{
+	sys_slist_t slist;
+
+	zassert_true(k_fifo_is_empty(pfifo));
+
+	k_fifo_put(pfifo, &data[0]);
+	zassert_false(k_fifo_is_empty(pfifo));
+	zassert_equal(k_fifo_peek_head(pfifo), &data[0]);
+
+	/**TESTPOINT: items put meanwhile stay behind the collected ones */
+	k_fifo_put(pfifo, &data[1]);
+	zassert_equal(k_fifo_peek_tail(pfifo), &data[1]);
+
+	sys_slist_init(&slist);
+	sys_slist_append(&slist, &data[2].snode);
+	sys_slist_append(&slist, &data[3].snode);
+	k_fifo_put_slist(pfifo, &slist);
+
+	for (int i = 0; i < LIST_LEN; i++) {
+		zassert_equal(k_fifo_get(pfifo, K_NO_WAIT), &data[i]);
+		if (i == 1) {
+			k_fifo_put(pfifo, &data[0]);
+		}
+	}
+	zassert_equal(k_fifo_get(pfifo, K_NO_WAIT), &data[0]);
+	zassert_is_null(k_fifo_get(pfifo, K_NO_WAIT));
+	zassert_true(k_fifo_is_empty(pfifo));
+}
+
+static void tfifo_put_isr(const void *p)
+{
+	k_fifo_put((struct k_fifo *)p, &data[0]);
+}
+
+static void tfifo_put_isr_entry(void *p1, void *p2, void *p3)
+{
+	irq_offload(tfifo_put_isr, p1);
+}
+
+static void tfifo_get_entry(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_fifo_get((struct k_fifo *)p1, K_FOREVER), p2);
+}
+
+static void tfifo_cancel_entry(void *p1, void *p2, void *p3)
+{
+	zassert_is_null(k_fifo_get((struct k_fifo *)p1, K_FOREVER));
+}
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+
+	for (int i = 0; i < ITEMS_PER_PRODUCER; i++) {
+		items[id][i].data = (id << 16) | i;
+		k_fifo_put(&fifo_ll, &items[id][i]);
+		if ((i % 8) == 0) {
+			k_yield();
+		}
+	}
+}
+
+static void consumer_entry(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+	fdata_t *item;
+
+	while ((item = k_fifo_get(&fifo_ll, K_MSEC(100))) != NULL) {
+		uint32_t producer = item->data >> 16;
+		uint32_t seq = item->data & 0xffff;
+
+		/* Each consumer sees the items of a producer in order */
+		zassert_true(seq >= last_seen[id][producer]);
+		last_seen[id][producer] = seq + 1;
+		received[id]++;
+	}
+}
+
+/**
+ * @addtogroup kernel_fifo_tests
+ * @{
+ */
+
+/**
+ * @brief Test lockless fifo ordering
+ * @see k_fifo_lockless_init(), k_fifo_put(), k_fifo_put_slist(),
+ * k_fifo_get(), k_fifo_peek_head(), k_fifo_peek_tail()
+ */
+ZTEST(fifo_api, test_fifo_lockless_order)
+{
+	/**TESTPOINT: init via k_fifo_lockless_init*/
+	k_fifo_lockless_init(&fifo_ll);
+	tfifo_put_get(&fifo_ll);
+
+	tfifo_put_get(&lfifo);
+}
+
+/**
+ * @brief Test waiting on a lockless fifo
+ * @see k_fifo_get(), k_fifo_cancel_wait()
+ */
+ZTEST(fifo_api_1cpu, test_fifo_lockless_wait)
+{
+	k_fifo_lockless_init(&fifo_ll);
+
+	/**TESTPOINT: a waiting thread gets an item put by a thread */
+	k_thread_create(&tdata[0], tstacks[0], STACK_SIZE, tfifo_get_entry,
+			&fifo_ll, &data[1], NULL, K_PRIO_PREEMPT(0), 0,
+			K_NO_WAIT);
+	k_msleep(10);
+	k_fifo_put(&fifo_ll, &data[1]);
+	k_thread_join(&tdata[0], K_FOREVER);
+
+	/**TESTPOINT: a waiting thread gets an item put by an ISR */
+	k_thread_create(&tdata[0], tstacks[0], STACK_SIZE, tfifo_get_entry,
+			&fifo_ll, &data[0], NULL, K_PRIO_PREEMPT(0), 0,
+			K_NO_WAIT);
+	k_msleep(10);
+	irq_offload(tfifo_put_isr, &fifo_ll);
+	k_thread_join(&tdata[0], K_FOREVER);
+
+	/**TESTPOINT: cancelling the wait does not make the thread retry */
+	k_thread_create(&tdata[0], tstacks[0], STACK_SIZE, tfifo_cancel_entry,
+			&fifo_ll, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(10);
+	k_fifo_cancel_wait(&fifo_ll);
+	k_thread_join(&tdata[0], K_FOREVER);
+
+	zassert_true(k_fifo_is_empty(&fifo_ll));
+}
+
+/**
+ * @brief Test several producers and consumers on a lockless fifo
+ * @see k_fifo_put(), k_fifo_get()
+ */
+ZTEST(fifo_api, test_fifo_lockless_mpmc)
+{
+	uint32_t total = 0;
+
+	k_fifo_lockless_init(&fifo_ll);
+	memset(last_seen, 0, sizeof(last_seen));
+	memset(received, 0, sizeof(received));
+
+	for (int i = 0; i < NUM_CONSUMERS; i++) {
+		k_thread_create(&tdata[i], tstacks[i], STACK_SIZE,
+				consumer_entry, INT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		k_thread_create(&tdata[NUM_CONSUMERS + i],
+				tstacks[NUM_CONSUMERS + i], STACK_SIZE,
+				producer_entry, INT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(tdata); i++) {
+		k_thread_join(&tdata[i], K_FOREVER);
+	}
+
+	for (int i = 0; i < NUM_CONSUMERS; i++) {
+		total += received[i];
+	}
+	zassert_equal(total, NUM_PRODUCERS * ITEMS_PER_PRODUCER);
+	zassert_true(k_fifo_is_empty(&fifo_ll));
+}
+
+#ifdef CONFIG_POLL
+/**
+ * @brief Test polling a lockless fifo
+ * @see k_poll()
+ */
+ZTEST(fifo_api_1cpu, test_fifo_lockless_poll)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_FIFO_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY,
+		&fifo_ll);
+
+	k_fifo_lockless_init(&fifo_ll);
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	/**TESTPOINT: an item put by an ISR wakes up the polling thread */
+	event.state = K_POLL_STATE_NOT_READY;
+	k_thread_create(&tdata[0], tstacks[0], STACK_SIZE,
+			tfifo_put_isr_entry, &fifo_ll, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_MSEC(10));
+	zassert_ok(k_poll(&event, 1, K_FOREVER));
+	zassert_equal(event.state, K_POLL_STATE_FIFO_DATA_AVAILABLE);
+	zassert_equal(k_fifo_get(&fifo_ll, K_NO_WAIT), &data[0]);
+	k_thread_join(&tdata[0], K_FOREVER);
+
+	/**TESTPOINT: items put while nobody polls are seen by k_poll() */
+	k_fifo_put(&fifo_ll, &data[1]);
+	k_fifo_put(&fifo_ll, &data[2]);
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_ok(k_poll(&event, 1, K_NO_WAIT));
+	zassert_equal(k_fifo_get(&fifo_ll, K_NO_WAIT), &data[1]);
+	zassert_equal(k_fifo_get(&fifo_ll, K_NO_WAIT), &data[2]);
+}
+#endif /* CONFIG_POLL */
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_QUEUE_LOCKLESS */
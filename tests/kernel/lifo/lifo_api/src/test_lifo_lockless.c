@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifdef CONFIG_QUEUE_LOCKLESS
+
+#include "test_lifo.h"
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define LIST_LEN 4
+
+/**TESTPOINT: init via K_LIFO_LOCKLESS_DEFINE*/
+K_LIFO_LOCKLESS_DEFINE(llifo);
+
+static struct k_lifo lifo_ll;
+static ldata_t data[LIST_LEN];
+
+static K_THREAD_STACK_DEFINE(tstack, STACK_SIZE);
+static struct k_thread tdata;
+
+static void tlifo_put_get(struct k_lifo *plifo)
+{
+	k_lifo_put(plifo, &data[0]);
+	k_lifo_put(plifo, &data[1]);
+	zassert_equal(k_lifo_get(plifo, K_NO_WAIT), &data[1]);
+
+	/**TESTPOINT: items put later are got first */
+	k_lifo_put(plifo, &data[2]);
+	k_lifo_put(plifo, &data[3]);
+	zassert_equal(k_lifo_get(plifo, K_NO_WAIT), &data[3]);
+	k_lifo_put(plifo, &data[1]);
+	zassert_equal(k_lifo_get(plifo, K_NO_WAIT), &data[1]);
+	zassert_equal(k_lifo_get(plifo, K_NO_WAIT), &data[2]);
+	zassert_equal(k_lifo_get(plifo, K_NO_WAIT), &data[0]);
+	zassert_is_null(k_lifo_get(plifo, K_NO_WAIT));
+}
+
+static void tlifo_get_entry(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_lifo_get((struct k_lifo *)p1, K_FOREVER), p2);
+}
+
+/**
+ * @addtogroup kernel_lifo_tests
+ * @{
+ */
+
+/**
+ * @brief Test lockless lifo ordering and waiting
+ * @see k_lifo_lockless_init(), k_lifo_put(), k_lifo_get()
+ */
+ZTEST(lifo_lockless_1cpu, test_lifo_lockless)
+{
+	/**TESTPOINT: init via k_lifo_lockless_init*/
+	k_lifo_lockless_init(&lifo_ll);
+	tlifo_put_get(&lifo_ll);
+
+	tlifo_put_get(&llifo);
+
+	/**TESTPOINT: a waiting thread gets the item put */
+	k_thread_create(&tdata, tstack, STACK_SIZE, tlifo_get_entry,
+			&lifo_ll, &data[0], NULL, K_PRIO_PREEMPT(0), 0,
+			K_NO_WAIT);
+	k_msleep(10);
+	k_lifo_put(&lifo_ll, &data[0]);
+	k_thread_join(&tdata, K_FOREVER);
+}
+
+/**
+ * @}
+ */
+
+ZTEST_SUITE(lifo_lockless_1cpu, NULL, NULL,
+	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
+
+#endif /* CONFIG_QUEUE_LOCKLESS */
@@ -265,3 +265,43 @@ ZTEST(k_heap_api, test_k_heap_alloc_pending_null)
 
 	k_heap_free(&k_heap_test, p);
 }
+
+/**
+ * @brief Test to demonstrate k_heap_alloc_n() and k_heap_free_n()
+ *
+ * @ingroup kernel_kheap_api_tests
+ *
+ * @details The test allocates several chunks at once, checks that a
+ * batch not fitting in the remaining space allocates nothing, with or
+ * without waiting, then frees all the chunks at once and checks the
+ * whole heap can be allocated again.
+ *
+ * @see k_heap_alloc_n(), k_heap_free_n()
+ */
+ZTEST(k_heap_api, test_k_heap_alloc_n)
+{
+	void *p[4];
+	void *q[2];
+	int ret;
+
+	ret = k_heap_alloc_n(&k_heap_test, p, ARRAY_SIZE(p), 128, K_NO_WAIT);
+	zassert_equal(ret, 0, "k_heap_alloc_n operation failed");
+	for (int i = 0; i < ARRAY_SIZE(p); i++) {
+		zassert_not_null(p[i], "k_heap_alloc_n returned a NULL chunk");
+		memset(p[i], 0, 128);
+	}
+
+	ret = k_heap_alloc_n(&k_heap_test, q, ARRAY_SIZE(q), ALLOC_SIZE_1,
+			     K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "k_heap_alloc_n should fail but did not");
+
+	ret = k_heap_alloc_n(&k_heap_test, q, ARRAY_SIZE(q), ALLOC_SIZE_1,
+			     K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "k_heap_alloc_n should time out but did not");
+
+	/* The failed batches must not have leaked a chunk */
+	k_heap_free_n(&k_heap_test, p, ARRAY_SIZE(p));
+	ret = k_heap_alloc_n(&k_heap_test, q, 1, ALLOC_SIZE_2, K_NO_WAIT);
+	zassert_equal(ret, 0, "k_heap_alloc_n operation failed");
+	k_heap_free_n(&k_heap_test, q, 1);
+}
@@ -9,10 +9,13 @@
 #include <zephyr/kernel/mm/demand_paging.h>
 #include <zephyr/timing/timing.h>
 #include <mmu.h>
+#include <kernel_arch_interface.h>
 #include <zephyr/linker/sections.h>
 
 #ifdef CONFIG_BACKING_STORE_RAM_PAGES
 #define EXTRA_PAGES	(CONFIG_BACKING_STORE_RAM_PAGES - 1)
+#elif defined(CONFIG_BACKING_STORE_COMPRESSED_PAGES)
+#define EXTRA_PAGES	(CONFIG_BACKING_STORE_COMPRESSED_PAGES - 1)
 #else
 #error "Unsupported configuration"
 #endif
@@ -113,6 +116,12 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	printk("* Read-ahead (%s):\n", scope);
+	printk("    - Sequential faults: %lu\n", stats->read_ahead.trigger);
+	printk("    - Pages read ahead: %lu\n", stats->read_ahead.pages);
+#endif
 }
 
 ZTEST(demand_paging, test_touch_anon_pages)
@@ -156,9 +165,11 @@ ZTEST(demand_paging, test_touch_anon_pages)
 	zassert_not_equal(stats.eviction.dirty, 0UL,
 			  "there should be dirty pages being evicted.");
 
-#ifdef CONFIG_EVICTION_NRU
+#if defined(CONFIG_EVICTION_NRU)
 	k_msleep(CONFIG_EVICTION_NRU_PERIOD * 2);
-#endif /* CONFIG_EVICTION_NRU */
+#elif defined(CONFIG_EVICTION_LRU)
+	k_msleep(CONFIG_EVICTION_LRU_PERIOD * 2);
+#endif
 
 	/* There should be some clean pages to be evicted now,
 	 * since the arena is not modified.
@@ -192,6 +203,104 @@ ZTEST(demand_paging, test_touch_anon_pages)
 	}
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+ZTEST(demand_paging, test_touch_anon_pages_read_ahead)
+{
+	unsigned long faults;
+	unsigned long read_ahead_pages;
+	struct k_mem_paging_stats_t stats;
+	int ret;
+
+	ret = k_mem_page_out(arena, HALF_BYTES);
+	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+
+	k_mem_paging_stats_get(&stats);
+	read_ahead_pages = stats.read_ahead.pages;
+	faults = z_num_pagefaults_get();
+
+	/* Read the paged out region sequentially, page by page */
+	for (size_t i = 0; i < HALF_PAGES; i++) {
+		zassert_equal(arena[i * CONFIG_MMU_PAGE_SIZE], 0,
+			      "arena corrupted at page %zu", i);
+
+		if (IS_ENABLED(CONFIG_DEMAND_PAGING_READ_AHEAD_ASYNC)) {
+			/* Let the read-ahead thread run */
+			k_msleep(1);
+		}
+	}
+
+	faults = z_num_pagefaults_get() - faults;
+	printk("Kernel handled %lu page faults for %d pages\n", faults,
+	       HALF_PAGES);
+	zassert_true(faults < HALF_PAGES, "no data page read ahead");
+
+	k_mem_paging_stats_get(&stats);
+	print_paging_stats(&stats, "kernel");
+	zassert_true(stats.read_ahead.pages > read_ahead_pages,
+		     "read-ahead not accounted");
+}
+
+/* With no free page frame left, reading ahead evicts other data pages, but
+ * not the ones it has just loaded, so it still saves page faults.
+ */
+ZTEST(demand_paging, test_touch_anon_pages_read_ahead_evict)
+{
+	unsigned long faults;
+	unsigned long read_ahead_pages;
+	unsigned long thread_read_ahead_pages;
+	struct k_mem_paging_stats_t stats;
+	size_t paged_out = 0;
+	uintptr_t location;
+
+	/* The arena doesn't fit in RAM, so touching all of it uses up
+	 * every free page frame.
+	 */
+	for (size_t i = 0; i < arena_size; i += CONFIG_MMU_PAGE_SIZE) {
+		arena[i] = 0;
+	}
+	zassert_equal(k_mem_free_get(), 0, "free page frames left");
+
+	for (size_t i = 0; i < arena_size; i += CONFIG_MMU_PAGE_SIZE) {
+		if (arch_page_location_get(&arena[i], &location) ==
+		    ARCH_PAGE_LOCATION_PAGED_OUT) {
+			paged_out++;
+		}
+	}
+	zassert_not_equal(paged_out, 0, "no data page paged out");
+
+	k_mem_paging_stats_get(&stats);
+	read_ahead_pages = stats.read_ahead.pages;
+	k_mem_paging_thread_stats_get(k_current_get(), &stats);
+	thread_read_ahead_pages = stats.read_ahead.pages;
+	faults = z_num_pagefaults_get();
+
+	/* Read the arena sequentially again, evicting data pages */
+	for (size_t i = 0; i < arena_size; i += CONFIG_MMU_PAGE_SIZE) {
+		zassert_equal(arena[i], 0, "arena corrupted at index %zu", i);
+
+		if (IS_ENABLED(CONFIG_DEMAND_PAGING_READ_AHEAD_ASYNC)) {
+			/* Let the read-ahead thread run */
+			k_msleep(1);
+		}
+	}
+
+	faults = z_num_pagefaults_get() - faults;
+	printk("Kernel handled %lu page faults for %zu paged out pages\n",
+	       faults, paged_out);
+	zassert_true(faults < paged_out, "no page fault saved");
+
+	k_mem_paging_stats_get(&stats);
+	print_paging_stats(&stats, "kernel");
+	zassert_true(stats.read_ahead.pages > read_ahead_pages,
+		     "no data page read ahead");
+
+	/* Read-ahead is accounted to the thread taking the page faults */
+	k_mem_paging_thread_stats_get(k_current_get(), &stats);
+	zassert_true(stats.read_ahead.pages > thread_read_ahead_pages,
+		     "read-ahead not accounted to the faulting thread");
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static void test_k_mem_page_out(void)
 {
 	unsigned long faults;
@@ -248,6 +357,78 @@ ZTEST(demand_paging_api, test_k_mem_page_in)
 		      faults);
 }
 
+#ifdef CONFIG_BACKING_STORE_COMPRESSED
+static uint32_t next_random(uint32_t *seed)
+{
+	*seed = *seed * 1103515245U + 12345U;
+
+	return *seed >> 16;
+}
+
+/* Checks the pseudo-random bytes the arena was filled with, from offset on */
+static void check_random(size_t offset)
+{
+	uint32_t seed = 1U;
+
+	for (size_t i = 0; i < arena_size; i++) {
+		char expected = (char)next_random(&seed);
+
+		if (i >= offset) {
+			zassert_equal(arena[i], expected,
+				      "arena corrupted at index %zu", i);
+		}
+	}
+}
+
+/* Show that page faults paging in data pages filled with zeroes, and paging
+ * out data pages which don't compress in their place, still succeed once
+ * data pages stored as is filled the pool of the compressed backing store.
+ */
+ZTEST(demand_paging_api, test_k_mem_page_out_compressed)
+{
+	struct k_mem_paging_backing_store_compressed_stats stats;
+	uint32_t seed = 1U;
+	size_t zeroed;
+	int ret = 0;
+
+	/* Fill the arena with pseudo-random bytes */
+	for (size_t i = 0; i < arena_size; i++) {
+		arena[i] = (char)next_random(&seed);
+	}
+
+	/* Zero data pages and page them out until the backing store
+	 * doesn't take more
+	 */
+	for (zeroed = 0; zeroed < arena_size; zeroed += CONFIG_MMU_PAGE_SIZE) {
+		(void)memset(arena + zeroed, 0, CONFIG_MMU_PAGE_SIZE);
+		ret = k_mem_page_out(arena + zeroed, CONFIG_MMU_PAGE_SIZE);
+		if (ret != 0) {
+			zeroed += CONFIG_MMU_PAGE_SIZE;
+			break;
+		}
+	}
+	zassert_equal(ret, -ENOMEM, "backing store took the whole arena");
+
+	/* Page the pseudo-random data pages back in, then the zeroed ones,
+	 * paging out the former in place of the latter
+	 */
+	check_random(zeroed);
+	for (size_t i = 0; i < zeroed; i++) {
+		zassert_equal(arena[i], 0, "arena corrupted at index %zu", i);
+	}
+
+	k_mem_paging_backing_store_compressed_stats_get(&stats);
+	zassert_not_equal(stats.incompressible, 0UL,
+			  "no data page stored as is");
+
+	check_random(zeroed);
+
+	for (size_t i = 0; i < arena_size; i++) {
+		arena[i] = 0;
+	}
+}
+#endif /* CONFIG_BACKING_STORE_COMPRESSED */
+
 ZTEST(demand_paging_api, test_k_mem_pin)
 {
 	unsigned long faults;
@@ -288,6 +469,37 @@ ZTEST(demand_paging_api, test_k_mem_unpin)
 	test_k_mem_page_out();
 }
 
+#ifdef CONFIG_BACKING_STORE_COMPRESSED
+/* Show that the data pages test_backing_store_capacity filled the backing
+ * store with, which are filled with digits, got compressed.
+ */
+ZTEST(demand_paging_stat, test_backing_store_compressed_stats)
+{
+	struct k_mem_paging_backing_store_compressed_stats stats;
+
+	k_mem_paging_backing_store_compressed_stats_get(&stats);
+
+	printk("Compressed backing store:\n");
+	printk("  pages: %lu (same filled %lu, incompressible %lu)\n",
+	       stats.pages, stats.same_filled, stats.incompressible);
+	printk("  pool usage: %zu bytes\n", stats.compr_size);
+	printk("  compressions: %lu, %llu cycles\n", stats.compressions,
+	       stats.compress_cycles);
+	printk("  decompressions: %lu, %llu cycles\n", stats.decompressions,
+	       stats.decompress_cycles);
+
+	zassert_not_equal(stats.compressions, 0UL,
+			  "no data pages paged out?");
+	zassert_not_equal(stats.decompressions, 0UL,
+			  "no data pages paged in?");
+	zassert_not_equal(stats.pages, 0UL, "no data pages stored?");
+	zassert_true(stats.pages > stats.same_filled + stats.incompressible,
+		     "no data page compressed");
+	zassert_true(stats.compr_size < stats.pages * CONFIG_MMU_PAGE_SIZE,
+		     "data pages didn't compress");
+}
+#endif /* CONFIG_BACKING_STORE_COMPRESSED */
+
 /* Show that even if we map enough anonymous memory to fill the backing
  * store, we can still handle pagefaults.
  * This eats up memory so should be last in the suite.
@@ -297,8 +509,7 @@ ZTEST(demand_paging_stat, test_backing_store_capacity)
 	char *mem, *ret;
 	unsigned int key;
 	unsigned long faults;
-	size_t size = (((CONFIG_BACKING_STORE_RAM_PAGES - 1) - HALF_PAGES) *
-		       CONFIG_MMU_PAGE_SIZE);
+	size_t size = ((EXTRA_PAGES - HALF_PAGES) * CONFIG_MMU_PAGE_SIZE);
 
 	/* Consume the rest of memory */
 	mem = k_mem_map(size, K_MEM_PERM_RW);
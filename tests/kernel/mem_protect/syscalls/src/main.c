@@ -6,6 +6,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/syscall_batch.h>
 #include <zephyr/ztest.h>
 #include <zephyr/linker/linker-defs.h>
 #include "test_syscalls.h"
@@ -446,6 +447,56 @@ ZTEST(syscalls, test_syscall_context)
 	k_thread_user_mode_enter(test_syscall_context_user, NULL, NULL, NULL);
 }
 
+#ifdef CONFIG_SYSCALL_BATCH
+/**
+ * @brief Test batched system calls
+ *
+ * @details Run several system calls with k_syscall_batch() from user
+ * mode and check that each of them returns what the same system call
+ * returns when invoked on its own.
+ *
+ * @ingroup kernel_memprotect_tests
+ *
+ * @see k_syscall_batch()
+ */
+ZTEST_USER(syscalls, test_syscall_batch)
+{
+	uint64_t arg = 54321;
+	int err = -1;
+	struct k_syscall_desc descs[] = {
+		{
+			.id = K_SYSCALL_STRING_NLEN,
+			.args = { (uintptr_t)user_string, BUF_SIZE,
+				  (uintptr_t)&err },
+		},
+		{
+			/* 64-bit argument, split on 32-bit targets */
+			.id = K_SYSCALL_SYSCALL_ARG64,
+			.args = { (uintptr_t)arg, (uintptr_t)(arg >> 32) },
+		},
+		{
+			.id = K_SYSCALL_SYSCALL_CONTEXT,
+		},
+	};
+	int ret;
+
+	ret = k_syscall_batch(descs, ARRAY_SIZE(descs));
+	if (!arch_is_user_context()) {
+		zassert_equal(ret, -ENOTSUP, "batch run from supervisor mode");
+		return;
+	}
+
+	zassert_equal(ret, 0, "batch failed");
+	zassert_equal(descs[0].ret, strlen(user_string),
+		      "incorrect length returned");
+	zassert_equal(err, 0, "user string faulted");
+	zassert_equal(descs[1].ret, z_impl_syscall_arg64(arg),
+		      "syscall didn't match impl");
+	zassert_true(descs[2].ret, "not reported in user syscall");
+	zassert_equal(k_syscall_batch(descs, 0), 0, "empty batch failed");
+}
+#endif /* CONFIG_SYSCALL_BATCH */
+
 K_HEAP_DEFINE(test_heap, BUF_SIZE * (4 * MAX_NR_THREADS));
 
 void *syscalls_setup(void)
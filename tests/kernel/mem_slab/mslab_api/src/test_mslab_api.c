@@ -338,3 +338,165 @@ ZTEST(mslab_api, test_mslab_pending)
 	/* Free memory block */
 	k_mem_slab_free(&kmslab, b);
 }
+
+/**
+ * @brief Verify allocating and freeing several blocks at once
+ *
+ * @details The test case checks that k_mem_slab_alloc_n() either
+ * allocates all the requested blocks or none of them, whether it
+ * returns right away or after waiting, and that k_mem_slab_free_n()
+ * returns all of them to the slab.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_alloc_n)
+{
+	void *b[BLK_NUM + 1];
+	int ret_value;
+
+	ret_value = k_mem_slab_alloc_n(&mslab, b, BLK_NUM + 1, K_NO_WAIT);
+	zassert_equal(-EINVAL, ret_value,
+		      "Failed k_mem_slab_alloc_n, retValue %d\n", ret_value);
+
+	ret_value = k_mem_slab_alloc_n(&mslab, b, 2, K_NO_WAIT);
+	zassert_equal(0, ret_value,
+		      "Failed k_mem_slab_alloc_n, retValue %d\n", ret_value);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 2);
+
+	/* Not enough blocks left: nothing is allocated */
+	ret_value = k_mem_slab_alloc_n(&mslab, &b[2], 2, K_NO_WAIT);
+	zassert_equal(-ENOMEM, ret_value,
+		      "Failed k_mem_slab_alloc_n, retValue %d\n", ret_value);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 2);
+
+	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
+		ret_value = k_mem_slab_alloc_n(&mslab, &b[2], 2, K_MSEC(20));
+		zassert_equal(-EAGAIN, ret_value,
+			      "Failed k_mem_slab_alloc_n, retValue %d\n", ret_value);
+		zassert_equal(k_mem_slab_num_used_get(&mslab), 2);
+	}
+
+	k_mem_slab_free_n(&mslab, b, 2);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 0);
+
+	ret_value = k_mem_slab_alloc_n(&mslab, b, BLK_NUM, K_NO_WAIT);
+	zassert_equal(0, ret_value,
+		      "Failed k_mem_slab_alloc_n, retValue %d\n", ret_value);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), 0);
+
+	k_mem_slab_free_n(&mslab, b, BLK_NUM);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 0);
+}
+
+static void *alloc_n_blocks[2];
+static int alloc_n_ret;
+
+static void alloc_n_helper(void *p1, void *p2, void *p3)
+{
+	alloc_n_ret = k_mem_slab_alloc_n(&mslab, alloc_n_blocks,
+					 ARRAY_SIZE(alloc_n_blocks), K_FOREVER);
+}
+
+/**
+ * @brief Verify pending for several blocks at once
+ *
+ * @details A helper thread waits for two blocks while all are in
+ * use. Freeing one block is not enough for it to complete, and it
+ * doesn't take that block while waiting. Freeing the others is
+ * enough.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_alloc_n_pending)
+{
+	if (!IS_ENABLED(CONFIG_MULTITHREADING)) {
+		ztest_test_skip();
+		return;
+	}
+
+	void *b[BLK_NUM];
+	int ret_value;
+
+	ret_value = k_mem_slab_alloc_n(&mslab, b, BLK_NUM, K_NO_WAIT);
+	zassert_equal(0, ret_value,
+		      "Failed k_mem_slab_alloc_n, retValue %d\n", ret_value);
+
+	alloc_n_ret = 1;
+	(void)k_thread_create(&HELPER, stack, STACKSIZE,
+			      alloc_n_helper, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+
+	k_mem_slab_free(&mslab, b[0]);
+	k_sleep(K_MSEC(10));
+	zassert_equal(alloc_n_ret, 1, "k_mem_slab_alloc_n returned early");
+	zassert_equal(k_mem_slab_num_free_get(&mslab), 1);
+
+	k_mem_slab_free_n(&mslab, &b[1], BLK_NUM - 1);
+	k_thread_join(&HELPER, K_FOREVER);
+	zassert_equal(alloc_n_ret, 0,
+		      "Failed k_mem_slab_alloc_n, retValue %d\n", alloc_n_ret);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 2);
+
+	k_mem_slab_free_n(&mslab, alloc_n_blocks, ARRAY_SIZE(alloc_n_blocks));
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 0);
+}
+
+static K_THREAD_STACK_DEFINE(stack_n, STACKSIZE);
+static struct k_thread helper_n;
+
+static void alloc_n_free_helper(void *p1, void *p2, void *p3)
+{
+	void *blocks[BLK_NUM];
+	int *ret = p1;
+
+	*ret = k_mem_slab_alloc_n(&mslab, blocks, BLK_NUM, K_MSEC(500));
+	if (*ret == 0) {
+		k_mem_slab_free_n(&mslab, blocks, BLK_NUM);
+	}
+}
+
+/**
+ * @brief Verify several threads pending for batches
+ *
+ * @details Two helper threads wait for all the blocks of the slab
+ * while they are in use, and the blocks are freed one by one. Neither
+ * may hold part of the blocks while waiting, which would deadlock
+ * them: both get all the blocks in turn.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_alloc_n_pending_many)
+{
+	if (!IS_ENABLED(CONFIG_MULTITHREADING)) {
+		ztest_test_skip();
+		return;
+	}
+
+	void *b[BLK_NUM];
+	int ret[2] = { 1, 1 };
+	int ret_value;
+
+	ret_value = k_mem_slab_alloc_n(&mslab, b, BLK_NUM, K_NO_WAIT);
+	zassert_equal(0, ret_value,
+		      "Failed k_mem_slab_alloc_n, retValue %d\n", ret_value);
+
+	(void)k_thread_create(&HELPER, stack, STACKSIZE,
+			      alloc_n_free_helper, &ret[0], NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	(void)k_thread_create(&helper_n, stack_n, STACKSIZE,
+			      alloc_n_free_helper, &ret[1], NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+
+	for (int i = 0; i < BLK_NUM; i++) {
+		k_mem_slab_free(&mslab, b[i]);
+		k_sleep(K_MSEC(10));
+	}
+
+	k_thread_join(&HELPER, K_FOREVER);
+	k_thread_join(&helper_n, K_FOREVER);
+	zassert_equal(ret[0], 0, "Failed k_mem_slab_alloc_n, retValue %d\n", ret[0]);
+	zassert_equal(ret[1], 0, "Failed k_mem_slab_alloc_n, retValue %d\n", ret[1]);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 0);
+}
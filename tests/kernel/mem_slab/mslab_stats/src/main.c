@@ -159,4 +159,48 @@ ZTEST(lib_mem_slab_stats_test, test_mem_slab_runtime_stats)
 		      2 * BLK_SZ, stats.max_allocated_bytes);
 }
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+K_MEM_SLAB_DEFINE_STATIC(cached_mslab, BLK_SZ, NUM_BLOCKS, 4);
+
+ZTEST(lib_mem_slab_stats_test, test_mem_slab_cpu_cache_stats)
+{
+	struct k_mem_slab_info info;
+	struct k_mem_slab_cpu_stats *cpu_stats = &info.cpu_stats[0];
+	uint32_t batch = CONFIG_MEM_SLAB_CPU_CACHE_SIZE / 2;
+	void *memory;
+	int   status;
+
+	/* The first allocation takes a block from the slab and refills the
+	 * cache with a batch of blocks, the rest hits the cache.
+	 */
+
+	for (int i = 0; i < 2; i++) {
+		status = k_mem_slab_alloc(&cached_mslab, &memory, K_NO_WAIT);
+		zassert_equal(status, 0, "Routine failed with status %d\n",
+			      status);
+		k_mem_slab_free(&cached_mslab, memory);
+	}
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&cached_mslab), &info,
+				      sizeof(info));
+	zassert_equal(status, 0, "Routine failed with status %d\n", status);
+
+	zassert_equal(cpu_stats->refills, 1, "Expected 1 refill, not %u\n",
+		      cpu_stats->refills);
+	zassert_equal(cpu_stats->hits, 3, "Expected 3 hits, not %u\n",
+		      cpu_stats->hits);
+	zassert_equal(cpu_stats->flushes, 0, "Expected 0 flushes, not %u\n",
+		      cpu_stats->flushes);
+	zassert_equal(cpu_stats->num_cached, batch + 1,
+		      "Expected %u cached blocks, not %u\n",
+		      batch + 1, cpu_stats->num_cached);
+	zassert_equal(k_mem_slab_num_used_get(&cached_mslab), 0,
+		      "Expected 0 used blocks, not %u\n",
+		      k_mem_slab_num_used_get(&cached_mslab));
+	zassert_equal(k_mem_slab_num_free_get(&cached_mslab), NUM_BLOCKS,
+		      "Expected %u free blocks, not %u\n",
+		      NUM_BLOCKS, k_mem_slab_num_free_get(&cached_mslab));
+}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 ZTEST_SUITE(lib_mem_slab_stats_test, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 4
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern struct k_msgq msgq;
+static char __aligned(4) cbuffer[MSG_SIZE * BATCH_LEN];
+static uint32_t cdata[2 * BATCH_LEN];
+
+static void fill_data(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(cdata); i++) {
+		cdata[i] = MSG0 + i;
+	}
+}
+
+static void get_n_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t rx[BATCH_LEN];
+
+	zassert_equal(k_msgq_get_n(&msgq, rx, ARRAY_SIZE(rx), K_FOREVER), 1);
+	zassert_equal(rx[0], MSG0);
+}
+
+static void get_claim_entry(void *p1, void *p2, void *p3)
+{
+	void *slot;
+
+	zassert_ok(k_msgq_get_claim(&msgq, &slot, K_FOREVER));
+	zassert_equal(*(uint32_t *)slot, MSG1);
+	zassert_ok(k_msgq_get_release(&msgq));
+}
+
+static void put_claim_entry(void *p1, void *p2, void *p3)
+{
+	void *slot;
+
+	zassert_ok(k_msgq_put_claim(&msgq, &slot, K_FOREVER));
+	*(uint32_t *)slot = MSG1;
+	zassert_ok(k_msgq_put_commit(&msgq));
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test sending and receiving several messages at once
+ * @see k_msgq_put_n(), k_msgq_get_n()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_put_get_n)
+{
+	uint32_t rx[2 * BATCH_LEN];
+
+	fill_data();
+	k_msgq_init(&msgq, cbuffer, MSG_SIZE, BATCH_LEN);
+
+	zassert_equal(k_msgq_put_n(&msgq, cdata, 0, K_NO_WAIT), -EINVAL);
+	zassert_equal(k_msgq_get_n(&msgq, rx, 0, K_NO_WAIT), -EINVAL);
+	zassert_equal(k_msgq_get_n(&msgq, rx, 1, K_NO_WAIT), -ENOMSG);
+
+	/**TESTPOINT: only the messages that fit are sent */
+	zassert_equal(k_msgq_put_n(&msgq, cdata, 3, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_put_n(&msgq, &cdata[3], 3, K_NO_WAIT), 1);
+	zassert_equal(k_msgq_put_n(&msgq, &cdata[4], 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_num_used_get(&msgq), BATCH_LEN);
+
+	/**TESTPOINT: messages are received in order */
+	zassert_equal(k_msgq_get_n(&msgq, rx, 3, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_get_n(&msgq, &rx[3], ARRAY_SIZE(rx), K_NO_WAIT), 1);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(rx[i], cdata[i]);
+	}
+
+	/**TESTPOINT: a batch is handed to a waiting receiver */
+	k_thread_create(&tdata, tstack, STACK_SIZE, get_n_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+	zassert_equal(k_msgq_put_n(&msgq, cdata, 2, K_NO_WAIT), 2);
+	k_thread_join(&tdata, K_FOREVER);
+	zassert_equal(k_msgq_get_n(&msgq, rx, ARRAY_SIZE(rx), K_NO_WAIT), 1);
+	zassert_equal(rx[0], cdata[1]);
+}
+
+/**
+ * @brief Test building a message in place
+ * @see k_msgq_put_claim(), k_msgq_put_commit()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_put_claim)
+{
+	uint32_t rx;
+	void *slot;
+	void *other;
+
+	fill_data();
+	k_msgq_init(&msgq, cbuffer, MSG_SIZE, BATCH_LEN);
+
+	zassert_equal(k_msgq_put_commit(&msgq), -EINVAL);
+	zassert_ok(k_msgq_put_claim(&msgq, &slot, K_NO_WAIT));
+	zassert_equal(k_msgq_put_claim(&msgq, &other, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_num_free_get(&msgq), BATCH_LEN - 1);
+
+	/**TESTPOINT: messages sent meanwhile are queued behind the claim */
+	zassert_ok(k_msgq_put(&msgq, &cdata[1], K_NO_WAIT));
+	zassert_equal(k_msgq_num_used_get(&msgq), 0);
+	zassert_equal(k_msgq_get(&msgq, &rx, K_NO_WAIT), -ENOMSG);
+
+	*(uint32_t *)slot = cdata[0];
+	zassert_ok(k_msgq_put_commit(&msgq));
+	zassert_equal(k_msgq_num_used_get(&msgq), 2);
+
+	zassert_ok(k_msgq_get(&msgq, &rx, K_NO_WAIT));
+	zassert_equal(rx, cdata[0]);
+	zassert_ok(k_msgq_get(&msgq, &rx, K_NO_WAIT));
+	zassert_equal(rx, cdata[1]);
+
+	/**TESTPOINT: a waiting claim gets the first freed slot */
+	zassert_equal(k_msgq_put_n(&msgq, cdata, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, K_NO_WAIT), -ENOMSG);
+	k_thread_create(&tdata, tstack, STACK_SIZE, put_claim_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+	zassert_ok(k_msgq_get(&msgq, &rx, K_NO_WAIT));
+	k_thread_join(&tdata, K_FOREVER);
+	for (int i = 1; i < BATCH_LEN; i++) {
+		zassert_ok(k_msgq_get(&msgq, &rx, K_NO_WAIT));
+		zassert_equal(rx, cdata[i]);
+	}
+	zassert_ok(k_msgq_get(&msgq, &rx, K_NO_WAIT));
+	zassert_equal(rx, MSG1);
+}
+
+/**
+ * @brief Test reading a message in place
+ * @see k_msgq_get_claim(), k_msgq_get_release()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_get_claim)
+{
+	uint32_t rx;
+	void *slot;
+	void *other;
+
+	fill_data();
+	k_msgq_init(&msgq, cbuffer, MSG_SIZE, BATCH_LEN);
+
+	zassert_equal(k_msgq_get_release(&msgq), -EINVAL);
+	zassert_equal(k_msgq_get_claim(&msgq, &slot, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put_n(&msgq, cdata, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+
+	zassert_ok(k_msgq_get_claim(&msgq, &slot, K_NO_WAIT));
+	zassert_equal(*(uint32_t *)slot, cdata[0]);
+	zassert_equal(k_msgq_get_claim(&msgq, &other, K_NO_WAIT), -EBUSY);
+
+	/**TESTPOINT: slots are only freed when the claim is released */
+	zassert_ok(k_msgq_get(&msgq, &rx, K_NO_WAIT));
+	zassert_equal(rx, cdata[1]);
+	zassert_equal(k_msgq_num_free_get(&msgq), 0);
+	zassert_equal(k_msgq_put(&msgq, &cdata[4], K_NO_WAIT), -ENOMSG);
+	zassert_equal(*(uint32_t *)slot, cdata[0]);
+
+	zassert_ok(k_msgq_get_release(&msgq));
+	zassert_equal(k_msgq_num_free_get(&msgq), 2);
+	zassert_ok(k_msgq_put(&msgq, &cdata[4], K_NO_WAIT));
+
+	k_msgq_purge(&msgq);
+	zassert_equal(k_msgq_num_free_get(&msgq), BATCH_LEN);
+
+	/**TESTPOINT: a waiting claim gets the next message sent */
+	k_thread_create(&tdata, tstack, STACK_SIZE, get_claim_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+	rx = MSG1;
+	zassert_ok(k_msgq_put(&msgq, &rx, K_NO_WAIT));
+	k_thread_join(&tdata, K_FOREVER);
+	zassert_equal(k_msgq_num_free_get(&msgq), BATCH_LEN);
+}
+
+/**
+ * @}
+ */
@@ -460,6 +460,61 @@ ZTEST(mutex_api_1cpu, test_mutex_timeout_race_during_priority_inversion)
 	k_mutex_unlock(&tmutex);
 }
 
+static int woken[2];
+static int woken_count;
+
+static void tThread_waiter_woken(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p3);
+
+	zassert_ok(k_mutex_lock((struct k_mutex *)p1, K_FOREVER));
+	woken[woken_count++] = POINTER_TO_INT(p2);
+	k_mutex_unlock((struct k_mutex *)p1);
+}
+
+/**
+ * @brief Test boosting the priority of a thread waiting on a mutex
+ *
+ * - Two threads of different priorities wait on a mutex.
+ * - The priority of the higher priority one gets raised while it waits,
+ *   as priority inheritance does to an owner waiting on another mutex.
+ * - Once the mutex is unlocked, both must get it, the boosted one first.
+ *
+ * @ingroup kernel_mutex_tests
+ *
+ * @see k_thread_priority_set()
+ */
+ZTEST(mutex_api_1cpu, test_mutex_waiter_priority_boost)
+{
+	k_tid_t tid1, tid2;
+
+	k_mutex_init(&tmutex);
+	woken_count = 0;
+
+	zassert_ok(k_mutex_lock(&tmutex, K_FOREVER));
+
+	tid1 = k_thread_create(&tdata, tstack, STACK_SIZE,
+			       tThread_waiter_woken, &tmutex, INT_TO_POINTER(1),
+			       NULL, K_PRIO_PREEMPT(THREAD_MID_PRIORITY), 0,
+			       K_NO_WAIT);
+	tid2 = k_thread_create(&tdata2, tstack2, STACK_SIZE,
+			       tThread_waiter_woken, &tmutex, INT_TO_POINTER(2),
+			       NULL, K_PRIO_PREEMPT(THREAD_LOW_PRIORITY), 0,
+			       K_NO_WAIT);
+
+	/* Let both threads pend on the mutex */
+	k_msleep(100);
+
+	k_thread_priority_set(tid1, K_PRIO_PREEMPT(THREAD_HIGH_PRIORITY));
+
+	zassert_ok(k_mutex_unlock(&tmutex));
+
+	zassert_ok(k_thread_join(tid1, K_MSEC(TIMEOUT)), "boosted waiter not woken");
+	zassert_ok(k_thread_join(tid2, K_MSEC(TIMEOUT)), "other waiter not woken");
+	zassert_equal(woken_count, 2);
+	zassert_equal(woken[0], 1, "boosted waiter not woken first");
+}
+
 static void *mutex_api_tests_setup(void)
 {
 #ifdef CONFIG_USERSPACE
@@ -62,11 +62,14 @@ ZTEST_BMEM SYS_MUTEX_DEFINE(mutex_2);
 ZTEST_BMEM SYS_MUTEX_DEFINE(mutex_3);
 ZTEST_BMEM SYS_MUTEX_DEFINE(mutex_4);
 
-#ifdef CONFIG_USERSPACE
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST_PATH)
 static SYS_MUTEX_DEFINE(no_access_mutex);
 #endif
 static ZTEST_BMEM SYS_MUTEX_DEFINE(not_my_mutex);
 static ZTEST_BMEM SYS_MUTEX_DEFINE(bad_count_mutex);
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+static ZTEST_BMEM SYS_MUTEX_DEFINE(fast_mutex);
+#endif
 
 #ifdef CONFIG_USERSPACE
 #define ZTEST_USER_OR_NOT ZTEST_USER
@@ -447,8 +450,10 @@ ZTEST(mutex_complex, test_supervisor_access)
 {
 	int rv;
 
-#ifdef CONFIG_USERSPACE
-	/* coverage for get_k_mutex checks */
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST_PATH)
+	/* coverage for get_k_mutex checks, the fast path doesn't look
+	 * mutexes up unless they are contended
+	 */
 	rv = sys_mutex_lock((struct sys_mutex *)NULL, K_NO_WAIT);
 	zassert_true(rv == -EINVAL, "accepted bad mutex pointer");
 	rv = sys_mutex_lock((struct sys_mutex *)k_current_get(), K_NO_WAIT);
@@ -457,7 +462,7 @@ ZTEST(mutex_complex, test_supervisor_access)
 	zassert_true(rv == -EINVAL, "accepted bad mutex pointer");
 	rv = sys_mutex_unlock((struct sys_mutex *)k_current_get());
 	zassert_true(rv == -EINVAL, "accepted object that was not a mutex");
-#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_USERSPACE && !CONFIG_SYS_MUTEX_FAST_PATH */
 
 	rv = sys_mutex_unlock(&not_my_mutex);
 	zassert_true(rv == -EPERM, "unlocked a mutex that wasn't owner");
@@ -467,7 +472,8 @@ ZTEST(mutex_complex, test_supervisor_access)
 
 ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 {
-#ifdef CONFIG_USERSPACE
+	/* An uncontended fast path access faults instead */
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST_PATH)
 	int rv;
 
 	rv = sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
@@ -476,7 +482,57 @@ ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 	zassert_true(rv == -EACCES, "accessed mutex not in memory domain");
 #else
 	ztest_test_skip();
-#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_USERSPACE && !CONFIG_SYS_MUTEX_FAST_PATH */
+}
+
+/**
+ * @brief Test that uncontended sys_mutexes are handled in user memory
+ *
+ * With CONFIG_SYS_MUTEX_FAST_PATH, the mutex holds the ID of its owner,
+ * and is only flagged as contended once a thread waits on it.
+ */
+ZTEST_USER_OR_NOT(mutex_complex, test_fast_path)
+{
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	int rv;
+
+	rv = sys_mutex_lock(&fast_mutex, K_NO_WAIT);
+	zassert_equal(rv, 0, "Failed to lock fast mutex");
+	zassert_equal(atomic_get(&fast_mutex.val), self, "owner not recorded");
+
+	rv = sys_mutex_lock(&fast_mutex, K_FOREVER);
+	zassert_equal(rv, 0, "Failed to recursively lock fast mutex");
+	zassert_equal(fast_mutex.lock_count, 2, "bad lock count");
+
+	rv = sys_mutex_unlock(&fast_mutex);
+	zassert_equal(rv, 0, "Failed to unlock fast mutex");
+	zassert_equal(atomic_get(&fast_mutex.val), self, "released too early");
+
+	/* thread_12 waits on private_mutex, flagging it as contended */
+	rv = sys_mutex_lock(&private_mutex, K_NO_WAIT);
+	zassert_equal(rv, 0, "Failed to lock private mutex");
+	k_thread_create(&thread_12_thread_data, thread_12_stack_area, STACKSIZE,
+			thread_12, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(12), PARTICIPANT_THREAD_OPTIONS, K_NO_WAIT);
+	k_sleep(K_MSEC(5));
+	zassert_equal(atomic_get(&private_mutex.val),
+		      self | SYS_MUTEX_CONTENDED, "contention not flagged");
+
+	/* Unlocking hands the mutex over to thread_12 */
+	rv = sys_mutex_unlock(&private_mutex);
+	zassert_equal(rv, 0, "Failed to unlock private mutex");
+	zassert_equal(atomic_get(&private_mutex.val),
+		      (atomic_val_t)&thread_12_thread_data, "not handed over");
+	k_thread_join(&thread_12_thread_data, K_FOREVER);
+	zassert_equal(atomic_get(&private_mutex.val), 0, "not released");
+
+	rv = sys_mutex_unlock(&fast_mutex);
+	zassert_equal(rv, 0, "Failed to unlock fast mutex");
+	zassert_equal(atomic_get(&fast_mutex.val), 0, "not released");
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
 }
 
 /*test case main entry*/
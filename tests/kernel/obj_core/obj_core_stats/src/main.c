@@ -693,6 +693,109 @@ ZTEST(obj_core_stats_mem_slab, test_obj_core_stats_mem_slab)
 	k_mem_slab_free(&mem_slab, mem2);
 }
 
+/***************** MUTEXES *********************/
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+K_MUTEX_DEFINE(mutex);
+static K_THREAD_STACK_DEFINE(mutex_thread_stack,
+			     1024 + CONFIG_TEST_EXTRA_STACK_SIZE);
+static struct k_thread mutex_thread;
+
+static void mutex_thread_entry(void *p1, void *p2, void *p3)
+{
+	bool wait = (bool)POINTER_TO_INT(p1);
+
+	if (k_mutex_lock(&mutex, wait ? K_FOREVER : K_NO_WAIT) == 0) {
+		k_mutex_unlock(&mutex);
+	}
+}
+
+static void mutex_thread_run(bool wait)
+{
+	k_thread_create(&mutex_thread, mutex_thread_stack,
+			K_THREAD_STACK_SIZEOF(mutex_thread_stack),
+			mutex_thread_entry, INT_TO_POINTER(wait), NULL, NULL,
+			K_HIGHEST_THREAD_PRIO, 0, K_NO_WAIT);
+}
+
+static void test_mutex_raw(const char *str, struct k_mutex_stats *expected)
+{
+	struct k_mutex_stats raw;
+	int  status;
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&mutex), &raw, sizeof(raw));
+	zassert_equal(status, 0,
+		      "%s: Failed to get raw stats (%d)\n", str, status);
+
+	zassert_equal(raw.locks, expected->locks,
+		      "%s: Expected %u locks, got %u\n",
+		      str, expected->locks, raw.locks);
+	zassert_equal(raw.contended, expected->contended,
+		      "%s: Expected %u contended, got %u\n",
+		      str, expected->contended, raw.contended);
+	zassert_equal(raw.spin_acquired, expected->spin_acquired,
+		      "%s: Expected %u spin_acquired, got %u\n",
+		      str, expected->spin_acquired, raw.spin_acquired);
+	zassert_equal(raw.pended, expected->pended,
+		      "%s: Expected %u pended, got %u\n",
+		      str, expected->pended, raw.pended);
+}
+
+ZTEST(obj_core_stats_mutex, test_obj_core_stats_mutex)
+{
+	struct k_mutex_stats raw = { 0 };
+	int  status;
+
+	status = k_obj_core_stats_disable(K_OBJ_CORE(&mutex));
+	zassert_equal(status, -ENOTSUP,
+		      "Not supposed to be supported. Got %d, not %d\n",
+		      status, -ENOTSUP);
+
+	test_mutex_raw("Initial", &raw);
+
+	/* Uncontended lock, recursive lock */
+
+	zassert_ok(k_mutex_lock(&mutex, K_FOREVER));
+	zassert_ok(k_mutex_lock(&mutex, K_FOREVER));
+	raw.locks += 2;
+	test_mutex_raw("Lock", &raw);
+
+	/* Contended lock without waiting */
+
+	mutex_thread_run(false);
+	k_thread_join(&mutex_thread, K_FOREVER);
+	raw.contended++;
+	test_mutex_raw("Busy", &raw);
+
+	/*
+	 * Contended lock pending on the mutex: the other CPUs are kept busy
+	 * by the 1cpu test setup, so the owner can't be spun on.
+	 */
+
+	mutex_thread_run(true);
+	k_msleep(10);
+	raw.contended++;
+	raw.pended++;
+	test_mutex_raw("Pended", &raw);
+
+	k_mutex_unlock(&mutex);
+	k_mutex_unlock(&mutex);
+	k_thread_join(&mutex_thread, K_FOREVER);
+	raw.locks++;
+	test_mutex_raw("Handed over", &raw);
+
+	/* Reset the mutex stats */
+
+	status = k_obj_core_stats_reset(K_OBJ_CORE(&mutex));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	memset(&raw, 0, sizeof(raw));
+	test_mutex_raw("Reset", &raw);
+}
+
+ZTEST_SUITE(obj_core_stats_mutex, NULL, NULL,
+	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+
 ZTEST_SUITE(obj_core_stats_system, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
 
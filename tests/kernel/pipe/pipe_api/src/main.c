@@ -19,12 +19,18 @@ extern struct k_sem end_sema;
 extern struct k_stack tstack;
 extern struct k_thread tdata;
 extern struct k_heap test_pool;
+#ifdef CONFIG_PIPE_SPSC
+extern struct k_pipe spsc_pipe;
+#endif
 
 static void *pipe_api_setup(void)
 {
 	k_thread_access_grant(k_current_get(), &pipe,
 			      &kpipe, &end_sema, &tdata, &tstack,
 			      &khalfpipe, &put_get_pipe);
+#ifdef CONFIG_PIPE_SPSC
+	k_thread_access_grant(k_current_get(), &spsc_pipe);
+#endif
 
 	k_thread_heap_assign(k_current_get(), &test_pool);
 
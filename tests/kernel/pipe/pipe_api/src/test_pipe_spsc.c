@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifdef CONFIG_PIPE_SPSC
+
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define SPSC_LEN	16
+#define STREAM_LEN	1000
+#define PUT_CHUNK	33
+#define GET_CHUNK	50
+
+K_PIPE_SPSC_DEFINE(spsc_pipe, SPSC_LEN, 4);
+
+static ZTEST_BMEM unsigned char tx_data[STREAM_LEN];
+static ZTEST_BMEM unsigned char rx_data[STREAM_LEN];
+
+extern struct k_thread tdata;
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+
+static void fill_tx_data(void)
+{
+	for (int i = 0; i < STREAM_LEN; i++) {
+		tx_data[i] = (unsigned char)(i * 7);
+	}
+	(void)memset(rx_data, 0, sizeof(rx_data));
+	k_pipe_flush(&spsc_pipe);
+}
+
+static void spsc_producer(void *p1, void *p2, void *p3)
+{
+	size_t written;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < STREAM_LEN; i += PUT_CHUNK) {
+		size_t len = MIN(PUT_CHUNK, STREAM_LEN - i);
+
+		zassert_ok(k_pipe_put(&spsc_pipe, &tx_data[i], len, &written,
+				      len, K_FOREVER));
+		zassert_equal(written, len);
+	}
+}
+
+/**
+ * @addtogroup kernel_pipe_tests
+ * @{
+ */
+
+/**
+ * @brief Test non-blocking transfers through a single reader, single
+ * writer pipe
+ *
+ * @see k_pipe_spsc_init(), k_pipe_put(), k_pipe_get()
+ */
+ZTEST_USER(pipe_api, test_pipe_spsc_no_wait)
+{
+	size_t written;
+	size_t read;
+
+	fill_tx_data();
+
+	zassert_equal(k_pipe_get(&spsc_pipe, rx_data, 1, &read, 1, K_NO_WAIT),
+		      -EIO);
+	zassert_equal(read, 0);
+
+	/**TESTPOINT: data wraps around the ring buffer */
+	for (int i = 0; i + 7 <= STREAM_LEN; i += 7) {
+		zassert_ok(k_pipe_put(&spsc_pipe, &tx_data[i], 7, &written, 7,
+				      K_NO_WAIT));
+		zassert_equal(written, 7);
+		zassert_equal(k_pipe_read_avail(&spsc_pipe), 7);
+		zassert_equal(k_pipe_write_avail(&spsc_pipe), SPSC_LEN - 7);
+		zassert_ok(k_pipe_get(&spsc_pipe, &rx_data[i], 7, &read, 7,
+				      K_NO_WAIT));
+		zassert_equal(read, 7);
+		zassert_mem_equal(&rx_data[i], &tx_data[i], 7);
+	}
+
+	/**TESTPOINT: partial transfers only down to min_xfer */
+	zassert_ok(k_pipe_put(&spsc_pipe, tx_data, SPSC_LEN + 4, &written, 1,
+			      K_NO_WAIT));
+	zassert_equal(written, SPSC_LEN);
+	zassert_equal(k_pipe_put(&spsc_pipe, tx_data, 1, &written, 1,
+				 K_NO_WAIT), -EIO);
+	zassert_equal(k_pipe_get(&spsc_pipe, rx_data, SPSC_LEN + 1, &read,
+				 SPSC_LEN + 1, K_NO_WAIT), -EIO);
+	zassert_ok(k_pipe_get(&spsc_pipe, rx_data, SPSC_LEN + 1, &read, 0,
+			      K_NO_WAIT));
+	zassert_equal(read, SPSC_LEN);
+	zassert_mem_equal(rx_data, tx_data, SPSC_LEN);
+
+	/**TESTPOINT: flushing drops the buffered data */
+	zassert_ok(k_pipe_put(&spsc_pipe, tx_data, 4, &written, 4, K_NO_WAIT));
+	k_pipe_flush(&spsc_pipe);
+	zassert_equal(k_pipe_read_avail(&spsc_pipe), 0);
+	zassert_equal(k_pipe_write_avail(&spsc_pipe), SPSC_LEN);
+}
+
+/**
+ * @brief Test blocking transfers through a single reader, single writer
+ * pipe
+ *
+ * @see k_pipe_spsc_init(), k_pipe_put(), k_pipe_get()
+ */
+ZTEST_USER(pipe_api_1cpu, test_pipe_spsc_stream)
+{
+	size_t read;
+
+	fill_tx_data();
+
+	/**TESTPOINT: waiting times out */
+	zassert_equal(k_pipe_get(&spsc_pipe, rx_data, 1, &read, 1, K_MSEC(10)),
+		      -EAGAIN);
+	zassert_equal(read, 0);
+
+	/**TESTPOINT: both sides wait for each other */
+	k_thread_create(&tdata, tstack, STACK_SIZE, spsc_producer,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0),
+			K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+
+	for (int i = 0; i < STREAM_LEN; i += GET_CHUNK) {
+		zassert_ok(k_pipe_get(&spsc_pipe, &rx_data[i], GET_CHUNK, &read,
+				      GET_CHUNK, K_FOREVER));
+		zassert_equal(read, GET_CHUNK);
+	}
+	zassert_mem_equal(rx_data, tx_data, STREAM_LEN);
+
+	k_thread_join(&tdata, K_FOREVER);
+}
+
+#ifdef CONFIG_POLL
+/**
+ * @brief Test polling a single reader, single writer pipe
+ *
+ * @see k_poll()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_spsc_poll)
+{
+	struct k_poll_event event;
+	size_t written;
+
+	fill_tx_data();
+
+	k_poll_event_init(&event, K_POLL_TYPE_PIPE_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &spsc_pipe);
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	zassert_ok(k_pipe_put(&spsc_pipe, tx_data, 1, &written, 1, K_NO_WAIT));
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_ok(k_poll(&event, 1, K_NO_WAIT));
+	zassert_equal(event.state, K_POLL_STATE_PIPE_DATA_AVAILABLE);
+	k_pipe_flush(&spsc_pipe);
+}
+#endif /* CONFIG_POLL */
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_PIPE_SPSC */
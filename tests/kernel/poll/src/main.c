@@ -15,12 +15,18 @@
 K_HEAP_DEFINE(test_heap, MAX_SZ * 4);
 extern void poll_test_grant_access(void);
 extern void poll_fail_grant_access(void);
+#ifdef CONFIG_POLL_SET
+extern void poll_set_grant_access(void);
+#endif
 
 /*test case main entry*/
 static void *poll_setup(void)
 {
 	poll_test_grant_access();
 	poll_fail_grant_access();
+#ifdef CONFIG_POLL_SET
+	poll_set_grant_access();
+#endif
 
 	k_thread_heap_assign(k_current_get(), &test_heap);
 
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifdef CONFIG_POLL_SET
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define NUM_SEMS 16
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_POLL_SET_DEFINE(test_set, NUM_SEMS + 2);
+static struct k_sem set_sems[NUM_SEMS];
+static struct k_sem set_extra_sem;
+static struct k_poll_signal set_signal;
+static struct k_msgq set_msgq;
+static char __aligned(4) set_msgq_buf[4 * sizeof(uint32_t)];
+
+static struct k_thread set_thread;
+K_THREAD_STACK_DEFINE(set_stack, STACK_SIZE);
+
+static void set_reset(void)
+{
+	for (int i = 0; i < NUM_SEMS; i++) {
+		k_sem_init(&set_sems[i], 0, 2);
+	}
+	k_sem_init(&set_extra_sem, 0, 2);
+	k_poll_signal_init(&set_signal);
+	k_msgq_init(&set_msgq, set_msgq_buf, sizeof(uint32_t), 4);
+}
+
+static void set_clear(void)
+{
+	for (int i = 0; i < NUM_SEMS; i++) {
+		(void)k_poll_set_remove(&test_set, &set_sems[i]);
+	}
+	(void)k_poll_set_remove(&test_set, &set_signal);
+	(void)k_poll_set_remove(&test_set, &set_msgq);
+}
+
+/**
+ * @brief Test adding, modifying and removing poll set objects
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_add(), k_poll_set_modify(), k_poll_set_remove()
+ */
+ZTEST_USER(poll_api_1cpu, test_poll_set_add_remove)
+{
+	set_reset();
+
+	for (int i = 0; i < NUM_SEMS; i++) {
+		zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+					  &set_sems[i], i, 0));
+	}
+	zassert_equal(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+				     &set_sems[0], 0, 0), -EEXIST);
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SIGNAL,
+				  &set_signal, 0, 0));
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+				  &set_msgq, 0, 0));
+	zassert_equal(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+				     &set_extra_sem, 0, 0), -ENOSPC);
+
+	zassert_ok(k_poll_set_modify(&test_set, &set_msgq, 42,
+				     K_POLL_SET_EDGE));
+	zassert_ok(k_poll_set_remove(&test_set, &set_msgq));
+	zassert_equal(k_poll_set_remove(&test_set, &set_msgq), -ENOENT);
+	zassert_equal(k_poll_set_modify(&test_set, &set_msgq, 0, 0), -ENOENT);
+
+	set_clear();
+}
+
+/**
+ * @brief Test level triggered poll set objects
+ *
+ * @details Only the objects that are ready get reported, and they keep
+ * being reported until their condition goes away.
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST_USER(poll_api_1cpu, test_poll_set_level)
+{
+	struct k_poll_event events[4];
+	uint32_t msg = 0xc0ffee;
+
+	set_reset();
+
+	for (int i = 0; i < NUM_SEMS; i++) {
+		zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+					  &set_sems[i], i, 0));
+	}
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+				  &set_msgq, 0xaa, 0));
+
+	zassert_equal(k_poll_set_wait(&test_set, events, ARRAY_SIZE(events),
+				      K_NO_WAIT), -EAGAIN);
+
+	k_sem_give(&set_sems[5]);
+	zassert_ok(k_msgq_put(&set_msgq, &msg, K_NO_WAIT));
+
+	zassert_equal(k_poll_set_wait(&test_set, events, ARRAY_SIZE(events),
+				      K_NO_WAIT), 2);
+	zassert_equal(events[0].sem, &set_sems[5]);
+	zassert_equal(events[0].tag, 5);
+	zassert_equal(events[0].state, K_POLL_STATE_SEM_AVAILABLE);
+	zassert_equal(events[1].msgq, &set_msgq);
+	zassert_equal(events[1].tag, 0xaa);
+	zassert_equal(events[1].state, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+
+	/* Still ready: reported again, one at a time if asked so */
+	zassert_equal(k_poll_set_wait(&test_set, events, 1, K_NO_WAIT), 1);
+	zassert_equal(events[0].sem, &set_sems[5]);
+	zassert_equal(k_poll_set_wait(&test_set, events, 1, K_NO_WAIT), 1);
+	zassert_equal(events[0].msgq, &set_msgq);
+
+	zassert_ok(k_sem_take(&set_sems[5], K_NO_WAIT));
+	zassert_ok(k_msgq_get(&set_msgq, &msg, K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&test_set, events, ARRAY_SIZE(events),
+				      K_NO_WAIT), -EAGAIN);
+
+	set_clear();
+}
+
+/**
+ * @brief Test edge triggered poll set objects
+ *
+ * @details An object is reported once each time it gets signaled, even
+ * if its condition still holds afterwards.
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST_USER(poll_api_1cpu, test_poll_set_edge)
+{
+	struct k_poll_event events[4];
+
+	set_reset();
+
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+				  &set_sems[0], 0, K_POLL_SET_EDGE));
+
+	k_sem_give(&set_sems[0]);
+	zassert_equal(k_poll_set_wait(&test_set, events, ARRAY_SIZE(events),
+				      K_NO_WAIT), 1);
+	zassert_equal(events[0].sem, &set_sems[0]);
+	zassert_equal(k_poll_set_wait(&test_set, events, ARRAY_SIZE(events),
+				      K_NO_WAIT), -EAGAIN);
+	zassert_equal(k_sem_count_get(&set_sems[0]), 1);
+
+	k_sem_give(&set_sems[0]);
+	zassert_equal(k_poll_set_wait(&test_set, events, ARRAY_SIZE(events),
+				      K_NO_WAIT), 1);
+	zassert_equal(k_poll_set_wait(&test_set, events, ARRAY_SIZE(events),
+				      K_NO_WAIT), -EAGAIN);
+
+	set_clear();
+}
+
+static void set_raise(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_poll_signal_raise(&set_signal, 0x1234);
+}
+
+/**
+ * @brief Test waiting on a poll set
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST_USER(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event events[4];
+	unsigned int signaled;
+	int result;
+
+	set_reset();
+
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SIGNAL,
+				  &set_signal, 7, 0));
+	zassert_ok(k_poll_set_add(&test_set, K_POLL_TYPE_SEM_AVAILABLE,
+				  &set_sems[0], 0, 0));
+
+	zassert_equal(k_poll_set_wait(&test_set, events, ARRAY_SIZE(events),
+				      K_MSEC(10)), -EAGAIN);
+
+	k_thread_create(&set_thread, set_stack, K_THREAD_STACK_SIZEOF(set_stack),
+			set_raise, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), K_USER | K_INHERIT_PERMS,
+			K_MSEC(50));
+
+	zassert_equal(k_poll_set_wait(&test_set, events, ARRAY_SIZE(events),
+				      K_FOREVER), 1);
+	zassert_equal(events[0].signal, &set_signal);
+	zassert_equal(events[0].tag, 7);
+	zassert_equal(events[0].state, K_POLL_STATE_SIGNALED);
+
+	k_poll_signal_check(&set_signal, &signaled, &result);
+	zassert_equal(signaled, 1);
+	zassert_equal(result, 0x1234);
+	k_poll_signal_reset(&set_signal);
+
+	k_thread_join(&set_thread, K_FOREVER);
+
+	set_clear();
+}
+
+void poll_set_grant_access(void)
+{
+	k_thread_access_grant(k_current_get(), &test_set, &set_signal,
+			      &set_msgq, &set_extra_sem, &set_thread, &set_stack);
+	for (int i = 0; i < NUM_SEMS; i++) {
+		k_thread_access_grant(k_current_get(), &set_sems[i]);
+	}
+}
+
+#endif /* CONFIG_POLL_SET */
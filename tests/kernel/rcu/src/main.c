@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_READERS 2
+#define NUM_OBJS    8
+#define NUM_UPDATES 200
+#define NUM_READS   1000
+
+#define ALIVE 0x600d600d
+#define DEAD  0xdeaddead
+
+struct obj {
+	struct k_rcu_head rcu;
+	uint32_t magic;
+	bool in_use;
+};
+
+static struct obj objs[NUM_OBJS];
+static struct obj *shared;
+static atomic_t reclaimed;
+static atomic_t violations;
+
+static K_THREAD_STACK_ARRAY_DEFINE(tstacks, NUM_READERS, STACK_SIZE);
+static struct k_thread tdata[NUM_READERS];
+
+static void obj_reclaim(struct k_rcu_head *head)
+{
+	struct obj *obj = CONTAINER_OF(head, struct obj, rcu);
+
+	obj->magic = DEAD;
+	obj->in_use = false;
+	atomic_inc(&reclaimed);
+}
+
+static struct obj *obj_alloc(void)
+{
+	for (int i = 0; i < NUM_OBJS; i++) {
+		unsigned int key = irq_lock();
+
+		if (!objs[i].in_use) {
+			objs[i].in_use = true;
+			irq_unlock(key);
+			objs[i].magic = ALIVE;
+			return &objs[i];
+		}
+		irq_unlock(key);
+	}
+
+	return NULL;
+}
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < NUM_READS; i++) {
+		unsigned int key = k_rcu_read_lock();
+		struct obj *obj = k_rcu_dereference(shared);
+
+		/* Give the writer a chance to reclaim obj too early */
+		k_busy_wait(1);
+		if ((obj != NULL) && (obj->magic != ALIVE)) {
+			atomic_inc(&violations);
+		}
+
+		k_rcu_read_unlock(key);
+		k_yield();
+	}
+}
+
+static void reclaim_isr(const void *arg)
+{
+	k_rcu_call((struct k_rcu_head *)arg, obj_reclaim);
+}
+
+/**
+ * @defgroup kernel_rcu_tests Read-Copy-Update
+ * @ingroup all_tests
+ * @{
+ */
+
+/**
+ * @brief Test deferring reclamation
+ * @see k_rcu_call(), k_rcu_synchronize()
+ */
+ZTEST(rcu, test_rcu_call)
+{
+	struct obj *old, *obj = obj_alloc();
+
+	k_rcu_assign_pointer(shared, obj);
+
+	/**TESTPOINT: readers see the published object */
+	unsigned int key = k_rcu_read_lock();
+
+	zassert_equal(k_rcu_dereference(shared), obj);
+	k_rcu_read_unlock(key);
+
+	/**TESTPOINT: the old object is reclaimed after a grace period */
+	old = obj;
+	obj = obj_alloc();
+	k_rcu_assign_pointer(shared, obj);
+	k_rcu_call(&old->rcu, obj_reclaim);
+	k_rcu_synchronize();
+	zassert_equal(atomic_get(&reclaimed), 1);
+	zassert_equal(old->magic, DEAD);
+
+	/**TESTPOINT: reclamation can be deferred from ISRs */
+	k_rcu_assign_pointer(shared, NULL);
+	irq_offload(reclaim_isr, &obj->rcu);
+	k_rcu_synchronize();
+	zassert_equal(atomic_get(&reclaimed), 2);
+	zassert_equal(obj->magic, DEAD);
+}
+
+/**
+ * @brief Test reclaiming objects while they are being read
+ * @see k_rcu_read_lock(), k_rcu_dereference(), k_rcu_assign_pointer()
+ */
+ZTEST(rcu, test_rcu_readers)
+{
+	int prio = k_thread_priority_get(k_current_get());
+	struct obj *old, *obj;
+	int updates = 0;
+
+	k_rcu_assign_pointer(shared, obj_alloc());
+
+	for (int i = 0; i < NUM_READERS; i++) {
+		k_thread_create(&tdata[i], tstacks[i], STACK_SIZE, reader_entry,
+				NULL, NULL, NULL, prio, 0, K_NO_WAIT);
+	}
+
+	while (updates < NUM_UPDATES) {
+		obj = obj_alloc();
+		if (obj == NULL) {
+			/* Wait for older versions to be reclaimed */
+			k_rcu_synchronize();
+			continue;
+		}
+
+		old = shared;
+		k_rcu_assign_pointer(shared, obj);
+		k_rcu_call(&old->rcu, obj_reclaim);
+		updates++;
+		k_yield();
+	}
+
+	for (int i = 0; i < NUM_READERS; i++) {
+		k_thread_join(&tdata[i], K_FOREVER);
+	}
+
+	k_rcu_synchronize();
+	zassert_equal(atomic_get(&violations), 0,
+		      "objects reclaimed while being read");
+	zassert_equal(atomic_get(&reclaimed), NUM_UPDATES);
+}
+
+/**
+ * @}
+ */
+
+static void rcu_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(objs, 0, sizeof(objs));
+	shared = NULL;
+	atomic_clear(&reclaimed);
+	atomic_clear(&violations);
+}
+
+ZTEST_SUITE(rcu, NULL, NULL, rcu_before, NULL, NULL);
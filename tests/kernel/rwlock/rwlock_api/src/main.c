@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+
+#define STACK_SIZE  (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_THREADS 3
+
+#define READ  0
+#define WRITE 1
+
+K_RWLOCK_DEFINE(rwlock, 0);
+K_RWLOCK_DEFINE(rwlock_pw, K_RWLOCK_PREFER_WRITER);
+K_SEM_DEFINE(release_sem, 0, NUM_THREADS);
+
+static K_THREAD_STACK_ARRAY_DEFINE(tstacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread tdata[NUM_THREADS];
+static int results[NUM_THREADS];
+static atomic_t holding;
+
+struct k_spin_rwlock spin_rwlock;
+
+/*
+ * Lock the reader-writer lock passed in p1 for reading or writing, and
+ * keep it until release_sem is given.
+ */
+static void lock_entry(void *p1, void *p2, void *p3)
+{
+	struct k_rwlock *lock = p1;
+	int id = POINTER_TO_INT(p2) >> 1;
+	int mode = POINTER_TO_INT(p2) & 1;
+	int32_t timeout_ms = POINTER_TO_INT(p3);
+
+	if (mode == READ) {
+		results[id] = k_rwlock_read_lock(lock, SYS_TIMEOUT_MS(timeout_ms));
+	} else {
+		results[id] = k_rwlock_write_lock(lock, SYS_TIMEOUT_MS(timeout_ms));
+	}
+
+	if (results[id] != 0) {
+		return;
+	}
+
+	atomic_inc(&holding);
+	k_sem_take(&release_sem, K_FOREVER);
+	atomic_dec(&holding);
+
+	if (mode == READ) {
+		zassert_ok(k_rwlock_read_unlock(lock));
+	} else {
+		zassert_ok(k_rwlock_write_unlock(lock));
+	}
+}
+
+static void spawn(int id, struct k_rwlock *lock, int mode, int prio,
+		  int32_t timeout_ms)
+{
+	results[id] = -EINPROGRESS;
+	k_thread_create(&tdata[id], tstacks[id], STACK_SIZE, lock_entry,
+			lock, INT_TO_POINTER((id << 1) | mode),
+			INT_TO_POINTER(timeout_ms), prio, 0, K_NO_WAIT);
+
+	/* Let it lock or wait */
+	k_msleep(10);
+}
+
+static int current_prio(void)
+{
+	return k_thread_priority_get(k_current_get());
+}
+
+/**
+ * @defgroup kernel_rwlock_tests Reader-Writer Locks
+ * @ingroup all_tests
+ * @{
+ */
+
+/**
+ * @brief Test locking and unlocking without contention
+ * @see k_rwlock_init(), k_rwlock_read_lock(), k_rwlock_read_unlock(),
+ * k_rwlock_write_lock(), k_rwlock_write_unlock()
+ */
+ZTEST_USER(rwlock_api, test_rwlock_lock_unlock)
+{
+	zassert_equal(k_rwlock_init(&rwlock, BIT(7)), -EINVAL);
+	zassert_ok(k_rwlock_init(&rwlock, 0));
+
+	zassert_equal(k_rwlock_read_unlock(&rwlock), -EINVAL);
+	zassert_equal(k_rwlock_write_unlock(&rwlock), -EPERM);
+
+	/**TESTPOINT: several readers share the lock */
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_MSEC(10)), -EAGAIN);
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+
+	/**TESTPOINT: a writer owns the lock exclusively */
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EDEADLK);
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_MSEC(10)), -EAGAIN);
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+}
+
+/**
+ * @brief Test handing the lock over to waiting threads
+ * @see k_rwlock_read_unlock(), k_rwlock_write_unlock()
+ */
+ZTEST(rwlock_api, test_rwlock_handover)
+{
+	int prio = current_prio();
+
+	/**TESTPOINT: the last reader hands the lock over to a writer */
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	spawn(0, &rwlock, WRITE, prio, SYS_FOREVER_MS);
+	zassert_equal(results[0], -EINPROGRESS);
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	k_msleep(10);
+	zassert_ok(results[0]);
+	zassert_equal(atomic_get(&holding), 1);
+	k_sem_give(&release_sem);
+	k_thread_join(&tdata[0], K_FOREVER);
+
+	/**TESTPOINT: a writer hands the lock over to all waiting readers */
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	for (int i = 0; i < NUM_THREADS; i++) {
+		spawn(i, &rwlock, READ, prio, SYS_FOREVER_MS);
+	}
+	zassert_equal(atomic_get(&holding), 0);
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+	k_msleep(10);
+	zassert_equal(atomic_get(&holding), NUM_THREADS);
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		zassert_ok(results[i]);
+		k_sem_give(&release_sem);
+	}
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&tdata[i], K_FOREVER);
+	}
+}
+
+/**
+ * @brief Test preferring writers over readers
+ * @see K_RWLOCK_PREFER_WRITER
+ */
+ZTEST(rwlock_api, test_rwlock_prefer_writer)
+{
+	int prio = current_prio();
+
+	/**TESTPOINT: by default, readers do not wait behind writers */
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	spawn(0, &rwlock, WRITE, prio, SYS_FOREVER_MS);
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	k_msleep(10);
+	zassert_ok(results[0]);
+	k_sem_give(&release_sem);
+	k_thread_join(&tdata[0], K_FOREVER);
+
+	/**TESTPOINT: with K_RWLOCK_PREFER_WRITER, they do */
+	zassert_ok(k_rwlock_read_lock(&rwlock_pw, K_NO_WAIT));
+	spawn(0, &rwlock_pw, WRITE, prio, 100);
+	zassert_equal(k_rwlock_read_lock(&rwlock_pw, K_NO_WAIT), -EBUSY);
+	spawn(1, &rwlock_pw, READ, prio, SYS_FOREVER_MS);
+	zassert_equal(results[1], -EINPROGRESS);
+
+	/**TESTPOINT: readers get the lock once the writer gives up */
+	k_thread_join(&tdata[0], K_FOREVER);
+	zassert_equal(results[0], -EAGAIN);
+	k_msleep(10);
+	zassert_ok(results[1]);
+	k_sem_give(&release_sem);
+	k_thread_join(&tdata[1], K_FOREVER);
+	zassert_ok(k_rwlock_read_unlock(&rwlock_pw));
+}
+
+/**
+ * @brief Test priority inheritance of writers
+ * @see k_rwlock_write_lock()
+ */
+ZTEST(rwlock_api, test_rwlock_priority_inheritance)
+{
+	int prio = current_prio();
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+
+	/**TESTPOINT: a waiting reader raises the priority of the writer */
+	spawn(0, &rwlock, READ, prio - 1, 100);
+	zassert_equal(current_prio(), prio - 1);
+
+	/**TESTPOINT: a waiting writer raises it further */
+	spawn(1, &rwlock, WRITE, prio - 2, 200);
+	zassert_equal(current_prio(), prio - 2);
+
+	/**TESTPOINT: the priority drops as waiters give up */
+	k_thread_join(&tdata[0], K_FOREVER);
+	zassert_equal(results[0], -EAGAIN);
+	zassert_equal(current_prio(), prio - 2);
+	k_thread_join(&tdata[1], K_FOREVER);
+	zassert_equal(results[1], -EAGAIN);
+	zassert_equal(current_prio(), prio);
+
+	/**TESTPOINT: the priority is restored on unlock */
+	spawn(0, &rwlock, WRITE, prio - 1, SYS_FOREVER_MS);
+	zassert_equal(current_prio(), prio - 1);
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+	zassert_equal(current_prio(), prio);
+	k_sem_give(&release_sem);
+	k_thread_join(&tdata[0], K_FOREVER);
+	zassert_ok(results[0]);
+}
+
+static void spin_rwlock_isr(const void *arg)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_write_lock(&spin_rwlock);
+	*(int *)arg += 1;
+	k_spin_write_unlock(&spin_rwlock, key);
+}
+
+/**
+ * @brief Test the spin reader-writer lock
+ * @see k_spin_read_lock(), k_spin_write_lock()
+ */
+ZTEST(rwlock_api, test_spin_rwlock)
+{
+	k_spinlock_key_t key1, key2;
+	int counter = 0;
+
+	key1 = k_spin_read_lock(&spin_rwlock);
+	key2 = k_spin_read_lock(&spin_rwlock);
+	k_spin_read_unlock(&spin_rwlock, key2);
+	k_spin_read_unlock(&spin_rwlock, key1);
+
+	key1 = k_spin_write_lock(&spin_rwlock);
+	counter++;
+	k_spin_write_unlock(&spin_rwlock, key1);
+
+	irq_offload(spin_rwlock_isr, &counter);
+	zassert_equal(counter, 2);
+}
+
+/**
+ * @}
+ */
+
+static void *rwlock_api_setup(void)
+{
+#ifdef CONFIG_USERSPACE
+	k_thread_access_grant(k_current_get(), &rwlock, &rwlock_pw);
+#endif
+	return NULL;
+}
+
+ZTEST_SUITE(rwlock_api, NULL, rwlock_api_setup, NULL, NULL, NULL);
@@ -215,4 +215,77 @@ ZTEST(suite_deadline, test_unqueued)
 	}
 }
 
+K_SEM_DEFINE(waitq_sem, 0, NUM_THREADS);
+
+void waitq_worker(void *p1, void *p2, void *p3)
+{
+	int tidx = POINTER_TO_INT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&waitq_sem, K_FOREVER);
+
+	zassert_true(n_exec >= 0 && n_exec < NUM_THREADS, "");
+
+	exec_order[n_exec++] = tidx;
+}
+
+/**
+ * @brief Validate that wait queues order threads of a same priority
+ * by deadline
+ *
+ * @details Have a bunch of threads with random deadlines pend on a
+ * semaphore, then wake them one at a time, letting each one run
+ * before waking the next one so that the order in which they run is
+ * the wait queue order.
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_waitq)
+{
+	int i;
+
+	n_exec = 0;
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		worker_tids[i] = k_thread_create(&worker_threads[i],
+				worker_stacks[i], STACK_SIZE,
+				waitq_worker, INT_TO_POINTER(i), NULL, NULL,
+				K_LOWEST_APPLICATION_THREAD_PRIO,
+				0, K_FOREVER);
+		thread_deadlines[i] = sys_rand32_get() & 0x3fffff00;
+	}
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		k_thread_deadline_set(&worker_threads[i], thread_deadlines[i]);
+	}
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		k_thread_start(worker_tids[i]);
+	}
+
+	/* Let them all pend */
+	k_sleep(K_MSEC(100));
+
+	zassert_true(n_exec == 0, "threads ran too soon");
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		k_sem_give(&waitq_sem);
+		k_sleep(K_MSEC(10));
+		zassert_true(n_exec == i + 1, "woken thread did not run");
+	}
+
+	for (i = 1; i < NUM_THREADS; i++) {
+		int d0 = thread_deadlines[exec_order[i-1]];
+		int d1 = thread_deadlines[exec_order[i]];
+
+		zassert_true(d0 <= d1, "threads woken in wrong order");
+	}
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		k_thread_abort(worker_tids[i]);
+	}
+}
+
 ZTEST_SUITE(suite_deadline, NULL, NULL, NULL, NULL, NULL);
@@ -1172,6 +1172,69 @@ ZTEST(smp, test_smp_switch_torture)
 	}
 }
 
+#if defined(CONFIG_MUTEX_ADAPTIVE_SPIN) && defined(CONFIG_OBJ_CORE_STATS_MUTEX)
+#define MUTEX_HOLD_US 1000
+
+static struct k_mutex spin_mutex;
+static volatile int spin_mutex_held;
+
+static void mutex_holder(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_ok(k_mutex_lock(&spin_mutex, K_NO_WAIT));
+	spin_mutex_held = 1;
+
+	/* Keep running, holding the mutex, on this CPU for a while */
+	k_busy_wait(MUTEX_HOLD_US);
+
+	zassert_ok(k_mutex_unlock(&spin_mutex));
+}
+
+/**
+ * @brief Test spinning on a mutex held on another CPU
+ *
+ * @ingroup kernel_smp_tests
+ *
+ * @details A cooperative thread locks a mutex and holds it for a short
+ * time while running on another CPU. Locking the mutex from this CPU
+ * meanwhile must get it by spinning, without pending on it.
+ */
+ZTEST(smp, test_mutex_adaptive_spin)
+{
+	struct k_mutex_stats stats;
+
+	BUILD_ASSERT((MUTEX_HOLD_US * 1000) < CONFIG_MUTEX_ADAPTIVE_SPIN_NS,
+		     "mutex held longer than spinning on it lasts");
+
+	k_mutex_init(&spin_mutex);
+	spin_mutex_held = 0;
+
+	/* The test thread being cooperative, this one runs elsewhere */
+	k_tid_t tid = k_thread_create(&t2, t2_stack, T2_STACK_SIZE,
+				      mutex_holder, NULL, NULL, NULL,
+				      K_PRIO_COOP(2), 0, K_NO_WAIT);
+
+	while (spin_mutex_held == 0) {
+	}
+
+	zassert_ok(k_mutex_lock(&spin_mutex, K_FOREVER));
+	zassert_ok(k_mutex_unlock(&spin_mutex));
+
+	k_thread_join(tid, K_FOREVER);
+
+	zassert_ok(k_obj_core_stats_raw(K_OBJ_CORE(&spin_mutex), &stats,
+					sizeof(stats)));
+	zassert_equal(stats.locks, 2, "mutex locked %u times", stats.locks);
+	zassert_equal(stats.contended, 1, "mutex contended %u times",
+		      stats.contended);
+	zassert_equal(stats.spin_acquired, 1, "mutex not acquired spinning");
+	zassert_equal(stats.pended, 0, "mutex pended on");
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN && CONFIG_OBJ_CORE_STATS_MUTEX */
+
 static void *smp_tests_setup(void)
 {
 	/* Sleep a bit to guarantee that both CPUs enter an idle
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/spinlock.h>
+
+#ifdef CONFIG_SPIN_LOCK_STATS
+
+#define STACK_SIZE 1024
+#define NUM_LOCKS  100
+
+static K_THREAD_STACK_DEFINE(holder_stack, STACK_SIZE);
+static struct k_thread holder_thread;
+static struct k_spinlock stats_lock;
+static atomic_t holding;
+static atomic_t trying;
+
+/* Sum of the statistics of the call sites that last took stats_lock */
+static void stats_sum(const struct k_spinlock_stats *stats, void *user_data)
+{
+	struct k_spinlock_stats *sum = user_data;
+
+	if (stats->lock != &stats_lock) {
+		return;
+	}
+
+	sum->acquired += stats->acquired;
+	sum->contended += stats->contended;
+	sum->hold_cycles += stats->hold_cycles;
+	sum->hold_cycles_max = MAX(sum->hold_cycles_max, stats->hold_cycles_max);
+	sum->spin_cycles += stats->spin_cycles;
+	sum->spin_cycles_max = MAX(sum->spin_cycles_max, stats->spin_cycles_max);
+}
+
+static void stats_get(struct k_spinlock_stats *sum)
+{
+	memset(sum, 0, sizeof(*sum));
+	k_spinlock_stats_foreach(stats_sum, sum);
+}
+
+static void holder_entry(void *p1, void *p2, void *p3)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	atomic_set(&holding, 1);
+	while (!atomic_get(&trying)) {
+		arch_spin_relax();
+	}
+	/* Let the other CPU spin for a while */
+	k_busy_wait(10);
+	k_spin_unlock(&stats_lock, key);
+}
+
+/**
+ * @brief Test spinlock statistics
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_spinlock_stats_foreach(), k_spinlock_stats_reset()
+ */
+ZTEST(spinlock, test_spinlock_stats)
+{
+	struct k_spinlock_stats sum;
+	k_spinlock_key_t key;
+
+	k_spinlock_stats_reset();
+
+	/**TESTPOINT: acquisitions and hold times are recorded */
+	for (int i = 0; i < NUM_LOCKS; i++) {
+		key = k_spin_lock(&stats_lock);
+		k_busy_wait(1);
+		k_spin_unlock(&stats_lock, key);
+	}
+	zassert_ok(k_spin_trylock(&stats_lock, &key));
+	k_spin_unlock(&stats_lock, key);
+
+	stats_get(&sum);
+	zassert_equal(sum.acquired, NUM_LOCKS + 1);
+	zassert_equal(sum.contended, 0);
+	zassert_true(sum.hold_cycles_max > 0);
+	zassert_true(sum.hold_cycles >= sum.hold_cycles_max);
+
+	/**TESTPOINT: waiting for a lock held by another CPU is recorded */
+	atomic_clear(&holding);
+	atomic_clear(&trying);
+	k_thread_create(&holder_thread, holder_stack, STACK_SIZE, holder_entry,
+			NULL, NULL, NULL, K_PRIO_COOP(0), 0, K_NO_WAIT);
+	while (!atomic_get(&holding)) {
+		arch_spin_relax();
+	}
+	atomic_set(&trying, 1);
+	key = k_spin_lock(&stats_lock);
+	k_spin_unlock(&stats_lock, key);
+	k_thread_join(&holder_thread, K_FOREVER);
+
+	stats_get(&sum);
+	zassert_equal(sum.acquired, NUM_LOCKS + 3);
+	zassert_equal(sum.contended, 1);
+	zassert_true(sum.spin_cycles_max > 0);
+
+	/**TESTPOINT: statistics can be reset */
+	k_spinlock_stats_reset();
+	stats_get(&sum);
+	zassert_equal(sum.acquired, 0);
+	zassert_equal(k_spinlock_stats_dropped(), 0);
+}
+
+#endif /* CONFIG_SPIN_LOCK_STATS */
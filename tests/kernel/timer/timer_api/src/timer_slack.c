@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/types.h>
+
+#ifdef CONFIG_TIMEOUT_SLACK
+
+/* In ticks, so that tick granularity doesn't affect the checks below */
+#define SLACK_PERIOD 10
+#define SLACK_PERIODS 5
+
+static struct k_timer exact_timer;
+static struct k_timer slack_timer;
+
+/**
+ * @brief Test timeouts with slack
+ *
+ * Verify that a timeout with slack expires on the same system timer
+ * wakeup as a later timeout within its slack, that it never expires
+ * later than its slack allows, and that periodic timers with slack
+ * don't drift.
+ *
+ * @ingroup kernel_timer_tests
+ *
+ * @see K_TIMEOUT_SLACK()
+ */
+ZTEST(timer_api, test_timer_slack)
+{
+	int64_t start, elapsed;
+
+	k_timer_init(&exact_timer, NULL, NULL);
+	k_timer_init(&slack_timer, NULL, NULL);
+
+	/**TESTPOINT: K_NO_WAIT and K_FOREVER can't have slack */
+	zassert_true(K_TIMEOUT_EQ(K_TIMEOUT_SLACK(K_NO_WAIT, K_MSEC(10)),
+				  K_NO_WAIT));
+	zassert_true(K_TIMEOUT_EQ(K_TIMEOUT_SLACK(K_FOREVER, K_MSEC(10)),
+				  K_FOREVER));
+
+	/**TESTPOINT: a timeout expires along with a later one within its slack */
+	k_timer_start(&exact_timer, K_TICKS(50), K_NO_WAIT);
+	zassert_equal(k_sleep(K_TIMEOUT_SLACK(K_TICKS(20), K_TICKS(60))), 0);
+	zassert_equal(k_timer_status_get(&exact_timer), 1,
+		      "sleep did not wait for the timer");
+
+	/**TESTPOINT: timeouts without slack are not delayed */
+	start = k_uptime_ticks();
+	k_timer_start(&slack_timer, K_TIMEOUT_SLACK(K_TICKS(20), K_TICKS(60)),
+		      K_NO_WAIT);
+	k_timer_start(&exact_timer, K_TICKS(20), K_NO_WAIT);
+	k_timer_status_sync(&exact_timer);
+	elapsed = k_uptime_ticks() - start;
+	zassert_true(elapsed <= 21, "timer expired after %lld ticks", elapsed);
+	zassert_equal(k_timer_status_get(&slack_timer), 1);
+
+	/**TESTPOINT: a timeout never expires later than its slack allows */
+	start = k_uptime_ticks();
+	k_sleep(K_TIMEOUT_SLACK(K_TICKS(10), K_TICKS(10)));
+	elapsed = k_uptime_ticks() - start;
+	zassert_true((elapsed >= 10) && (elapsed <= 22),
+		     "slept for %lld ticks", elapsed);
+
+	/**TESTPOINT: periodic timers keep their period */
+	start = k_uptime_ticks();
+	k_timer_start(&slack_timer, K_TICKS(SLACK_PERIOD),
+		      K_TIMEOUT_SLACK(K_TICKS(SLACK_PERIOD), K_TICKS(5)));
+	for (int i = 0; i < SLACK_PERIODS; i++) {
+		k_timer_status_sync(&slack_timer);
+	}
+	elapsed = k_uptime_ticks() - start;
+	k_timer_stop(&slack_timer);
+	zassert_true((elapsed >= SLACK_PERIOD * SLACK_PERIODS) &&
+		     (elapsed <= (SLACK_PERIOD * SLACK_PERIODS) + 5 + 1),
+		     "%d periods took %lld ticks", SLACK_PERIODS, elapsed);
+}
+
+#endif /* CONFIG_TIMEOUT_SLACK */
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+
+#ifdef CONFIG_SCHED_LATENCY_STATS
+
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_WAKEUPS 10
+
+static K_THREAD_STACK_DEFINE(waiter_stack, STACK_SIZE);
+static struct k_thread waiter_thread;
+static K_SEM_DEFINE(wakeup_sem, 0, 1);
+
+static void waiter_entry(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < NUM_WAKEUPS + 1; i++) {
+		k_sem_take(&wakeup_sem, K_FOREVER);
+	}
+}
+
+static void isr_give(const void *arg)
+{
+	k_sem_give((struct k_sem *)arg);
+}
+
+static uint32_t buckets_sum(const struct k_sched_latency_hist *hist)
+{
+	uint32_t sum = 0U;
+
+	for (int i = 0; i < CONFIG_SCHED_LATENCY_STATS_BUCKETS; i++) {
+		sum += hist->buckets[i];
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Test the scheduling latency histograms
+ *
+ * This routine wakes up a thread of higher priority than the test thread
+ * from both thread and interrupt context, and verifies that its wakeup,
+ * preemption and interrupt latencies are recorded, both for the thread
+ * and for its priority.
+ *
+ * @see k_sched_latency_stats_get(), k_sched_latency_stats_reset()
+ */
+ZTEST(usage_api, test_sched_latency_stats)
+{
+	struct k_sched_latency_stats prio_stats;
+	k_thread_runtime_stats_t stats;
+	k_tid_t tid;
+	int priority;
+
+	priority = k_thread_priority_get(k_current_get()) - 1;
+
+	k_sched_latency_stats_reset();
+	zassert_ok(k_sched_latency_stats_get(priority, &prio_stats));
+	zassert_equal(prio_stats.wakeup.count, 0);
+
+	tid = k_thread_create(&waiter_thread, waiter_stack, STACK_SIZE,
+			      waiter_entry, NULL, NULL, NULL,
+			      priority, 0, K_NO_WAIT);
+
+	/* Let the waiter pend on the semaphore */
+	k_msleep(10);
+
+	/**TESTPOINT: wakeups from a lower priority thread are preemptions */
+	for (int i = 0; i < NUM_WAKEUPS; i++) {
+		k_sem_give(&wakeup_sem);
+		k_msleep(1);
+	}
+
+	zassert_ok(k_thread_runtime_stats_get(tid, &stats));
+	/* Starting the waiter counts as well */
+	zassert_equal(stats.latency.preempt.count, NUM_WAKEUPS + 1);
+	zassert_equal(stats.latency.wakeup.count, NUM_WAKEUPS + 1);
+	zassert_equal(stats.latency.irq.count, 0);
+
+	/**TESTPOINT: wakeups from interrupt handlers are recorded */
+	irq_offload(isr_give, &wakeup_sem);
+	k_thread_join(tid, K_FOREVER);
+
+	zassert_ok(k_thread_runtime_stats_get(tid, &stats));
+	zassert_equal(stats.latency.wakeup.count, NUM_WAKEUPS + 2);
+	zassert_equal(stats.latency.irq.count, 1);
+	zassert_equal(buckets_sum(&stats.latency.wakeup),
+		      stats.latency.wakeup.count);
+	zassert_true(stats.latency.wakeup.total_ns >=
+		     stats.latency.wakeup.max_ns);
+
+	/**TESTPOINT: latencies are accounted for at the thread priority */
+	zassert_ok(k_sched_latency_stats_get(priority, &prio_stats));
+	zassert_equal(prio_stats.wakeup.count, stats.latency.wakeup.count);
+	zassert_equal(prio_stats.preempt.count, stats.latency.preempt.count);
+	zassert_equal(prio_stats.irq.count, 1);
+
+	zassert_ok(k_thread_runtime_stats_all_get(&stats));
+	zassert_true(stats.latency.wakeup.count >= prio_stats.wakeup.count);
+
+	zassert_equal(k_sched_latency_stats_get(K_LOWEST_THREAD_PRIO + 1,
+						&prio_stats), -EINVAL);
+
+	/**TESTPOINT: reset clears the per priority histograms */
+	k_sched_latency_stats_reset();
+	zassert_ok(k_sched_latency_stats_get(priority, &prio_stats));
+	zassert_equal(prio_stats.wakeup.count, 0);
+}
+
+#endif /* CONFIG_SCHED_LATENCY_STATS */
@@ -1442,6 +1442,190 @@ ZTEST(work_1cpu, test_1cpu_system_reschedule)
 		     "long %u > %u\n", elapsed_ms, max_ms);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+
+#define POOL_WORKERS 2
+
+static K_THREAD_STACK_DEFINE(pool_stack, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(pool_worker_stacks, POOL_WORKERS, STACK_SIZE);
+static struct k_work_q_worker pool_workers[POOL_WORKERS];
+static struct k_work_q pool_queue;
+
+/* Work items blocking until released, recording whether they were ever
+ * run concurrently with themselves.
+ */
+struct pool_item {
+	struct k_work work;
+	struct k_sem rel;
+	atomic_t running;
+	atomic_t runs;
+};
+
+static struct pool_item pool_items[2];
+static atomic_t pool_overlap;
+
+static void pool_handler(struct k_work *work)
+{
+	struct pool_item *item = CONTAINER_OF(work, struct pool_item, work);
+
+	if (atomic_inc(&item->running) != 0) {
+		atomic_set(&pool_overlap, 1);
+	}
+	atomic_inc(&item->runs);
+	k_sem_take(&item->rel, K_FOREVER);
+	atomic_dec(&item->running);
+}
+
+static void pool_release_cb(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	for (int i = 0; i < ARRAY_SIZE(pool_items); i++) {
+		k_sem_give(&pool_items[i].rel);
+	}
+}
+
+static K_TIMER_DEFINE(pool_releaser, pool_release_cb, NULL);
+
+static void pool_setup(void)
+{
+	static bool started;
+
+	if (!started) {
+		k_work_queue_start(&pool_queue, pool_stack,
+				   K_THREAD_STACK_SIZEOF(pool_stack),
+				   COOPLO_PRIORITY, NULL);
+		for (int i = 0; i < POOL_WORKERS; i++) {
+			k_work_queue_worker_add(&pool_queue, &pool_workers[i],
+						pool_worker_stacks[i],
+						K_THREAD_STACK_SIZEOF(pool_worker_stacks[i]));
+		}
+		started = true;
+	}
+
+	atomic_clear(&pool_overlap);
+	for (int i = 0; i < ARRAY_SIZE(pool_items); i++) {
+		k_work_init(&pool_items[i].work, pool_handler);
+		k_sem_init(&pool_items[i].rel, 0, 1);
+		atomic_clear(&pool_items[i].running);
+		atomic_clear(&pool_items[i].runs);
+	}
+}
+
+/* Distinct items submitted to a pool queue run concurrently */
+ZTEST(work_1cpu, test_1cpu_pool_concurrent)
+{
+	int rc;
+
+	pool_setup();
+
+	for (int i = 0; i < ARRAY_SIZE(pool_items); i++) {
+		rc = k_work_submit_to_queue(&pool_queue, &pool_items[i].work);
+		zassert_equal(rc, 1);
+	}
+
+	/* Let the queue threads pick them up and block. */
+	k_sleep(K_MSEC(10));
+	for (int i = 0; i < ARRAY_SIZE(pool_items); i++) {
+		zassert_equal(k_work_busy_get(&pool_items[i].work),
+			      K_WORK_RUNNING);
+		zassert_equal(atomic_get(&pool_items[i].runs), 1);
+	}
+
+	pool_release_cb(NULL);
+	k_sleep(K_MSEC(10));
+	for (int i = 0; i < ARRAY_SIZE(pool_items); i++) {
+		zassert_equal(k_work_busy_get(&pool_items[i].work), 0);
+	}
+	zassert_equal(atomic_get(&pool_overlap), 0);
+}
+
+/* An item resubmitted while running is not picked up by another
+ * thread of the pool until its current run completes.
+ */
+ZTEST(work_1cpu, test_1cpu_pool_no_reentry)
+{
+	struct pool_item *item = &pool_items[0];
+	int rc;
+
+	pool_setup();
+
+	rc = k_work_submit_to_queue(&pool_queue, &item->work);
+	zassert_equal(rc, 1);
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_work_busy_get(&item->work), K_WORK_RUNNING);
+
+	/* Resubmission goes to the running queue and waits. */
+	rc = k_work_submit_to_queue(&pool_queue, &item->work);
+	zassert_equal(rc, 2);
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_work_busy_get(&item->work),
+		      K_WORK_RUNNING | K_WORK_QUEUED);
+	zassert_equal(atomic_get(&item->runs), 1);
+
+	/* Completing the first run starts the second one. */
+	k_sem_give(&item->rel);
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_work_busy_get(&item->work), K_WORK_RUNNING);
+	zassert_equal(atomic_get(&item->runs), 2);
+
+	k_sem_give(&item->rel);
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_work_busy_get(&item->work), 0);
+	zassert_equal(atomic_get(&pool_overlap), 0);
+}
+
+/* Flushing a running item waits for it even with idle pool threads */
+ZTEST(work_1cpu, test_1cpu_pool_running_flush)
+{
+	struct pool_item *item = &pool_items[0];
+	uint32_t start_ms;
+	int rc;
+
+	pool_setup();
+
+	rc = k_work_submit_to_queue(&pool_queue, &item->work);
+	zassert_equal(rc, 1);
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_work_busy_get(&item->work), K_WORK_RUNNING);
+
+	start_ms = k_uptime_get_32();
+	k_timer_start(&pool_releaser, DELAY_TIMEOUT, K_NO_WAIT);
+	zassert_true(k_work_flush(&item->work, &work_sync));
+	zassert_true((k_uptime_get_32() - start_ms) >= DELAY_MS);
+	zassert_equal(k_work_busy_get(&item->work), 0);
+
+	/* Drain the semaphore given to the unused item. */
+	(void)k_sem_take(&pool_items[1].rel, K_NO_WAIT);
+}
+
+/* Draining a pool queue waits for all its threads to be idle */
+ZTEST(work_1cpu, test_1cpu_pool_drain)
+{
+	uint32_t start_ms;
+	int rc;
+
+	pool_setup();
+
+	for (int i = 0; i < ARRAY_SIZE(pool_items); i++) {
+		rc = k_work_submit_to_queue(&pool_queue, &pool_items[i].work);
+		zassert_equal(rc, 1);
+	}
+	k_sleep(K_MSEC(10));
+
+	start_ms = k_uptime_get_32();
+	k_timer_start(&pool_releaser, DELAY_TIMEOUT, K_NO_WAIT);
+	rc = k_work_queue_drain(&pool_queue, false);
+	zassert_equal(rc, 1);
+	zassert_true((k_uptime_get_32() - start_ms) >= DELAY_MS);
+	for (int i = 0; i < ARRAY_SIZE(pool_items); i++) {
+		zassert_equal(k_work_busy_get(&pool_items[i].work), 0);
+	}
+	zassert_equal(atomic_get(&pool_overlap), 0);
+}
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 ZTEST(work, test_nop)
 {
 	ztest_test_skip();
@@ -52,6 +52,12 @@
 
 #define SCRATCH_SZ (sizeof(heapmem) / 2)
 
+#define MEDIUM_HEAP_SZ MIN(BIG_HEAP_SZ, 64 * 1024)
+
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+#define SMALL_OBJECT_MAX (8 << (CONFIG_SYS_HEAP_SMALL_OBJECT_CLASSES - 1))
+#endif
+
 /* The test memory.  Make them pointer arrays for robust alignment
  * behavior
  */
@@ -129,6 +135,16 @@ void *testalloc(void *arg, size_t bytes)
 		size_t hdr = addr - chunk;
 		size_t expect = ROUND_UP(bytes + hdr, 8) - hdr;
 
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+		/* Small objects are rounded up to their size class,
+		 * unless no page could be allocated for that class.
+		 */
+		if (bytes <= SMALL_OBJECT_MAX && blksz != expect) {
+			for (expect = 8; expect < bytes; expect <<= 1) {
+			}
+		}
+#endif
+
 		zassert_equal(blksz, expect,
 			      "wrong size block returned bytes = %ld ret = %ld",
 			      bytes, blksz);
@@ -259,6 +275,11 @@ ZTEST(lib_heap, test_solo_free_header)
 
 	TC_PRINT("Testing solo free header in a heap\n");
 
+	if (IS_ENABLED(CONFIG_SYS_HEAP_SMALL_OBJECTS)) {
+		/* The small object state does not fit such a heap */
+		ztest_test_skip();
+	}
+
 	sys_heap_init(&heap, heapmem, SOLO_FREE_HEADER_HEAP_SZ);
 	if (sizeof(void *) > 4U) {
 		sys_heap_alloc(&heap, 1);
@@ -298,6 +319,10 @@ ZTEST(lib_heap, test_realloc)
 	/* Note whitebox assumption: allocation goes from low address
 	 * to high in an empty heap.
 	 */
+	if (IS_ENABLED(CONFIG_SYS_HEAP_SMALL_OBJECTS)) {
+		/* The sizes below are served from size classes */
+		ztest_test_skip();
+	}
 
 	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
 
@@ -387,6 +412,102 @@ ZTEST(lib_heap, test_realloc)
 		     "Realloc should have moved %p", p2);
 }
 
+/* Small allocations are served from size classes carved out of
+ * pages: check objects of a class are packed together, rounded up to
+ * their class size, and that emptied pages go back to the heap.
+ */
+ZTEST(lib_heap, test_small_objects)
+{
+#ifdef CONFIG_SYS_HEAP_SMALL_OBJECTS
+	struct sys_heap heap;
+	void *p[64];
+	void *big;
+
+	sys_heap_init(&heap, heapmem, MEDIUM_HEAP_SZ);
+
+	for (int i = 0; i < ARRAY_SIZE(p); i++) {
+		p[i] = sys_heap_alloc(&heap, 12);
+		zassert_not_null(p[i], "small object allocation failed");
+		zassert_equal(sys_heap_usable_size(&heap, p[i]), 16);
+		memset(p[i], 0xa5, 16);
+	}
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	/* No per object header */
+	zassert_equal((uint8_t *)p[1] - (uint8_t *)p[0], 16);
+
+	/* Freed objects are reused first */
+	sys_heap_free(&heap, p[10]);
+	zassert_equal(sys_heap_alloc(&heap, 9), p[10]);
+
+	/* Growing an object past its class moves it */
+	big = sys_heap_realloc(&heap, p[0], 200);
+	zassert_not_null(big, "realloc failed");
+	zassert_true(big != p[0], "realloc should have moved %p", p[0]);
+	zassert_equal(sys_heap_realloc(&heap, p[1], 5), p[1]);
+	sys_heap_free(&heap, big);
+
+	for (int i = 1; i < ARRAY_SIZE(p); i++) {
+		sys_heap_free(&heap, p[i]);
+	}
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	/* Only the last page of the class is kept */
+	struct sys_memory_stats stats;
+
+	sys_heap_runtime_stats_get(&heap, &stats);
+	zassert_true(stats.allocated_bytes <
+		     2 * CONFIG_SYS_HEAP_SMALL_OBJECT_PAGE_SIZE,
+		     "memory held by small objects was not released");
+#else
+	ztest_test_skip();
+#endif
+}
+
+static void *stress_alloc(void *arg, size_t bytes)
+{
+	void *ret = sys_heap_alloc(arg, bytes);
+
+	fill_block(ret, bytes);
+	return ret;
+}
+
+static void stress_free(void *arg, void *p)
+{
+	check_fill(p);
+	sys_heap_free(arg, p);
+}
+
+/* Mostly small allocations (see sys_heap_stress()) over a mid-sized
+ * heap, without validating the heap on each operation: compare the
+ * numbers reported with and without CONFIG_SYS_HEAP_SMALL_OBJECTS.
+ */
+ZTEST(lib_heap, test_small_objects_stress)
+{
+	struct sys_heap heap;
+	struct z_heap_stress_result result;
+	uint32_t ops = 8 * ITERATION_COUNT;
+	uint32_t start, cycles;
+
+	TC_PRINT("Testing %d byte heap, small objects %s\n",
+		 (int) MEDIUM_HEAP_SZ,
+		 IS_ENABLED(CONFIG_SYS_HEAP_SMALL_OBJECTS) ? "on" : "off");
+
+	sys_heap_init(&heap, heapmem, MEDIUM_HEAP_SZ);
+
+	start = k_cycle_get_32();
+	sys_heap_stress(stress_alloc, stress_free, &heap,
+			MEDIUM_HEAP_SZ, ops,
+			scratchmem, sizeof(scratchmem),
+			90, &result);
+	cycles = k_cycle_get_32() - start;
+
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+	log_result(MEDIUM_HEAP_SZ, &result);
+	TC_PRINT("%u ns per operation\n",
+		 (uint32_t)(k_cyc_to_ns_floor64(cycles) / ops));
+}
+
 #ifdef CONFIG_SYS_HEAP_LISTENER
 static struct sys_heap listener_heap;
 static uintptr_t listener_heap_id;
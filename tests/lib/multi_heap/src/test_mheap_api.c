@@ -245,6 +245,59 @@ ZTEST(mheap_api, test_malloc_in_thread)
 	k_thread_abort(tid);
 }
 
+/**
+ * @brief Validate the k_malloc() per-CPU caches
+ *
+ * @details A block released with k_free() is kept in the cache of the
+ * current CPU, reported as free by the heap statistics, and handed out
+ * again by the next k_malloc() of the same size class.  Memory held by
+ * the caches remains available to allocations of other sizes.
+ *
+ * @ingroup kernel_heap_tests
+ *
+ * @see k_malloc(), k_free()
+ */
+ZTEST(mheap_api, test_mheap_cpu_cache)
+{
+#ifdef CONFIG_HEAP_MEM_POOL_CPU_CACHE
+	void *p, *q;
+
+	p = k_malloc(SIZE);
+	zassert_not_null(p, "k_malloc failed");
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	extern struct k_heap _system_heap;
+	struct sys_memory_stats before, after;
+
+	sys_heap_runtime_stats_get(&_system_heap.heap, &before);
+	k_free(p);
+	sys_heap_runtime_stats_get(&_system_heap.heap, &after);
+	zassert_true(after.allocated_bytes < before.allocated_bytes,
+		     "cached block reported as allocated");
+	zassert_true(after.free_bytes > before.free_bytes,
+		     "cached block not reported as free");
+#else
+	k_free(p);
+#endif
+
+	q = k_malloc(SIZE - 1);
+	zassert_equal(p, q, "block not reused from the CPU cache");
+	k_free(q);
+
+	/* Fill caches of several size classes */
+	for (size_t sz = SIZE; sz <= BLK_SIZE_MIN; sz *= 2) {
+		p = k_malloc(sz);
+		zassert_not_null(p, "k_malloc failed");
+		k_free(p);
+	}
+
+	p = k_malloc(BOUNDS);
+	zassert_not_null(p, "cached memory not given back to the heap");
+	k_free(p);
+#else
+	ztest_test_skip();
+#endif
+}
+
 void *multi_heap_choice(struct sys_multi_heap *mheap, void *cfg,
 			size_t align, size_t size)
 {